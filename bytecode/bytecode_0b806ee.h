@@ -27,6 +27,7 @@ public:
 	virtual int get_token_max() const override;
 	virtual int get_function_index(const String &p_func) const override;
 	virtual GDScriptDecomp::GlobalToken get_global_token(int p_token) const override;
+	virtual const GDScriptDecomp::GlobalToken *get_global_token_table() const override;
 	virtual int get_local_token_val(GDScriptDecomp::GlobalToken p_token) const override;
 	virtual int get_bytecode_version() const override { return bytecode_version; }
 	virtual int get_bytecode_rev() const override { return bytecode_rev; }
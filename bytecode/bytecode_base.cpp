@@ -19,6 +19,8 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/io/marshalls.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 #include "modules/gdscript/gdscript_tokenizer_buffer.h"
 
 #include <limits.h>
@@ -49,6 +51,7 @@ void GDScriptDecomp::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("decompile_byte_code_encrypted", "path", "key"), &GDScriptDecomp::decompile_byte_code_encrypted);
 	ClassDB::bind_method(D_METHOD("test_bytecode", "buffer"), &GDScriptDecomp::test_bytecode);
 	ClassDB::bind_method(D_METHOD("compile_code_string", "code"), &GDScriptDecomp::compile_code_string);
+	ClassDB::bind_method(D_METHOD("compile_files", "files", "output_dir"), &GDScriptDecomp::compile_files);
 
 	ClassDB::bind_method(D_METHOD("get_script_text"), &GDScriptDecomp::get_script_text);
 	ClassDB::bind_method(D_METHOD("get_error_message"), &GDScriptDecomp::get_error_message);
@@ -176,7 +179,7 @@ int decompress_buf(const Vector<uint8_t> &p_buffer, Vector<uint8_t> &contents) {
 #define GDSC_HEADER "GDSC"
 #define CHECK_GDSC_HEADER(p_buffer) _GDRE_CHECK_HEADER(p_buffer, GDSC_HEADER)
 
-Error GDScriptDecomp::get_ids_consts_tokens_v2(const Vector<uint8_t> &p_buffer, int bytecode_version, Vector<StringName> &identifiers, Vector<Variant> &constants, Vector<uint32_t> &tokens, VMap<uint32_t, uint32_t> &lines, VMap<uint32_t, uint32_t> &columns) {
+Error GDScriptDecomp::get_ids_consts_tokens_v2(const Vector<uint8_t> &p_buffer, int bytecode_version, Vector<StringName> &identifiers, Vector<Variant> &constants, Vector<uint32_t> &tokens, Vector<uint32_t> &lines, Vector<uint32_t> &columns) {
 	const uint8_t *buf = p_buffer.ptr();
 	GDSDECOMP_FAIL_COND_V_MSG(p_buffer.size() < 12 || !CHECK_GDSC_HEADER(p_buffer), ERR_INVALID_DATA, "Invalid GDScript tokenizer buffer.");
 
@@ -234,24 +237,30 @@ Error GDScriptDecomp::get_ids_consts_tokens_v2(const Vector<uint8_t> &p_buffer,
 		constants.write[i] = v;
 	}
 
+	GDSDECOMP_FAIL_COND_V_MSG((uint64_t)token_line_count * 16 > (uint64_t)total_len, ERR_INVALID_DATA, "Invalid token line count.");
+	// every token takes at least 5 bytes
+	GDSDECOMP_FAIL_COND_V_MSG((uint64_t)token_count * 5 > (uint64_t)total_len - (uint64_t)token_line_count * 16, ERR_INVALID_DATA, "Invalid token count.");
+	lines.resize(token_count);
+	lines.fill(0);
+	columns.resize(token_count);
+	columns.fill(0);
+	uint32_t *lines_w = lines.ptrw();
+	uint32_t *columns_w = columns.ptrw();
 	for (uint32_t i = 0; i < token_line_count; i++) {
-		GDSDECOMP_FAIL_COND_V_MSG(total_len < 8, ERR_INVALID_DATA, "Invalid token line count.");
 		uint32_t token_index = decode_uint32(b);
-		b += 4;
-		uint32_t line = decode_uint32(b);
-		b += 4;
-		total_len -= 8;
-		lines[token_index] = line;
+		if (token_index < token_count) {
+			lines_w[token_index] = decode_uint32(b + 4);
+		}
+		b += 8;
 	}
 	for (uint32_t i = 0; i < token_line_count; i++) {
-		GDSDECOMP_FAIL_COND_V_MSG(total_len < 8, ERR_INVALID_DATA, "Invalid token column count.");
 		uint32_t token_index = decode_uint32(b);
-		b += 4;
-		uint32_t column = decode_uint32(b);
-		b += 4;
-		total_len -= 8;
-		columns[token_index] = column;
+		if (token_index < token_count) {
+			columns_w[token_index] = decode_uint32(b + 4);
+		}
+		b += 8;
 	}
+	total_len -= (int)token_line_count * 16;
 
 	tokens.resize(token_count);
 	for (uint32_t i = 0; i < token_count; i++) {
@@ -283,7 +292,7 @@ Error GDScriptDecomp::get_script_state(const Vector<uint8_t> &p_buffer, ScriptSt
 	return get_ids_consts_tokens(p_buffer, r_state.identifiers, r_state.constants, r_state.tokens, r_state.lines, r_state.columns);
 }
 
-Error GDScriptDecomp::get_ids_consts_tokens(const Vector<uint8_t> &p_buffer, Vector<StringName> &identifiers, Vector<Variant> &constants, Vector<uint32_t> &tokens, VMap<uint32_t, uint32_t> &lines, VMap<uint32_t, uint32_t> &columns) {
+Error GDScriptDecomp::get_ids_consts_tokens(const Vector<uint8_t> &p_buffer, Vector<StringName> &identifiers, Vector<Variant> &constants, Vector<uint32_t> &tokens, Vector<uint32_t> &lines, Vector<uint32_t> &columns) {
 	const uint8_t *buf = p_buffer.ptr();
 	int total_len = p_buffer.size();
 	GDSDECOMP_FAIL_COND_V_MSG(p_buffer.size() < 24 || !CHECK_GDSC_HEADER(p_buffer), ERR_INVALID_DATA, "Invalid GDScript token buffer.");
@@ -334,15 +343,21 @@ Error GDScriptDecomp::get_ids_consts_tokens(const Vector<uint8_t> &p_buffer, Vec
 		constants.write[i] = v;
 	}
 
-	GDSDECOMP_FAIL_COND_V_MSG(line_count * sizeof(VMap<uint32_t, uint32_t>::Pair) > total_len, ERR_INVALID_DATA, "Invalid line count.");
+	GDSDECOMP_FAIL_COND_V_MSG(line_count < 0 || (int64_t)line_count * 8 > total_len, ERR_INVALID_DATA, "Invalid line count.");
+	GDSDECOMP_FAIL_COND_V_MSG(token_count < 0 || token_count > total_len - line_count * 8, ERR_INVALID_DATA, "Invalid token count.");
 
+	lines.resize(token_count);
+	lines.fill(0);
+	uint32_t *lines_w = lines.ptrw();
 	for (int i = 0; i < line_count; i++) {
 		uint32_t token = decode_uint32(b);
 		b += 4;
 		uint32_t linecol = decode_uint32(b);
 		b += 4;
 
-		lines.insert(token, linecol);
+		if (token < (uint32_t)token_count) {
+			lines_w[token] = linecol;
+		}
 		total_len -= 8;
 	}
 	tokens.resize(token_count);
@@ -562,8 +577,8 @@ Error GDScriptDecomp::debug_print(Vector<uint8_t> p_buffer) {
 	Vector<StringName> &identifiers = script_state.identifiers;
 	Vector<Variant> &constants = script_state.constants;
 	Vector<uint32_t> &tokens = script_state.tokens;
-	VMap<uint32_t, uint32_t> &lines = script_state.lines;
-	VMap<uint32_t, uint32_t> &columns = script_state.columns;
+	Vector<uint32_t> &lines = script_state.lines;
+	Vector<uint32_t> &columns = script_state.columns;
 	int version = script_state.bytecode_version;
 	int bytecode_version = get_bytecode_version();
 	int variant_ver_major = get_variant_ver_major();
@@ -619,6 +634,61 @@ Error GDScriptDecomp::debug_print(Vector<uint8_t> p_buffer) {
 	return OK;
 }
 
+namespace {
+// Append-only UTF-32 buffer used to build the script text; String::operator+= reallocates and copies far too often on large scripts
+class ScriptTextBuffer {
+	LocalVector<char32_t> buf;
+
+public:
+	void reserve(uint32_t p_size) { buf.reserve(p_size); }
+	void clear() { buf.clear(); } // keeps the capacity around for the next line
+	bool is_empty() const { return buf.is_empty(); }
+	bool ends_with(char32_t p_char) const { return !buf.is_empty() && buf[buf.size() - 1] == p_char; }
+
+	void append(const char32_t *p_str, int p_len) {
+		if (p_len <= 0) {
+			return;
+		}
+		uint32_t size = buf.size();
+		buf.resize(size + p_len);
+		memcpy(buf.ptr() + size, p_str, p_len * sizeof(char32_t));
+	}
+	void append(const ScriptTextBuffer &p_other) { append(p_other.buf.ptr(), p_other.buf.size()); }
+	void append_repeat(char32_t p_char, int p_count) {
+		if (p_count <= 0) {
+			return;
+		}
+		uint32_t size = buf.size();
+		buf.resize(size + p_count);
+		for (uint32_t i = size; i < buf.size(); i++) {
+			buf[i] = p_char;
+		}
+	}
+
+	ScriptTextBuffer &operator+=(const String &p_str) {
+		append(p_str.ptr(), p_str.length());
+		return *this;
+	}
+	ScriptTextBuffer &operator+=(const char *p_str) {
+		// only ever used with ASCII literals
+		while (*p_str) {
+			buf.push_back((uint8_t)*p_str++);
+		}
+		return *this;
+	}
+
+	String as_string() const {
+		String ret;
+		if (!buf.is_empty()) {
+			ret.resize(buf.size() + 1);
+			memcpy(ret.ptrw(), buf.ptr(), buf.size() * sizeof(char32_t));
+			ret.ptrw()[buf.size()] = 0;
+		}
+		return ret;
+	}
+};
+} // namespace
+
 Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 #if 0
 	debug_print(p_buffer);
@@ -633,9 +703,10 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 	Vector<StringName> &identifiers = script_state.identifiers;
 	Vector<Variant> &constants = script_state.constants;
 	Vector<uint32_t> &tokens = script_state.tokens;
-	VMap<uint32_t, uint32_t> &lines = script_state.lines;
-	VMap<uint32_t, uint32_t> &columns = script_state.columns;
+	Vector<uint32_t> &columns = script_state.columns;
 	int version = script_state.bytecode_version;
+	Vector<GlobalToken> global_tokens;
+	get_global_tokens(tokens, global_tokens);
 
 	int bytecode_version = get_bytecode_version();
 	int variant_ver_major = get_variant_ver_major();
@@ -643,20 +714,17 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 	GDSDECOMP_FAIL_COND_V(version != get_bytecode_version(), ERR_INVALID_DATA);
 
 	auto get_line_func([&](int i) {
-		if (lines.has(i)) {
-			return lines[i];
-		}
-		return 0U;
+		return script_state.get_line(i);
 	});
 	auto get_col_func([&](int i) {
-		if (columns.has(i)) {
-			return columns[i];
-		}
-		return 0U;
+		return script_state.get_column(i);
 	});
 
 	//Decompile script
-	String line;
+	// Rough guess at the output size so that most scripts never have to grow the buffer
+	ScriptTextBuffer text;
+	text.reserve(tokens.size() * 8);
+	ScriptTextBuffer line;
 	int indent = 0;
 
 	GlobalToken prev_token = G_TK_NEWLINE;
@@ -670,21 +738,19 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 	}
 
 	auto handle_newline = [&](int i, GlobalToken curr_token, int curr_line, int curr_column) {
-		for (int j = 0; j < indent; j++) {
-			script_text += use_spaces ? " " : "\t";
-		}
-		script_text += line;
+		text.append_repeat(use_spaces ? ' ' : '\t', indent);
+		text.append(line);
 		if (curr_line <= prev_line) {
 			curr_line = prev_line + 1; // force new line
 		}
 		while (curr_line > prev_line) {
 			if (curr_token != G_TK_NEWLINE && bytecode_version < GDSCRIPT_2_0_VERSION) {
-				script_text += "\\"; // line continuation
+				text += "\\"; // line continuation
 			}
-			script_text += "\n";
+			text += "\n";
 			prev_line++;
 		}
-		line = String();
+		line.clear();
 		if (curr_token == G_TK_NEWLINE) {
 			indent = tokens[i] >> TOKEN_BITS;
 		} else if (bytecode_version >= GDSCRIPT_2_0_VERSION) {
@@ -710,15 +776,15 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 	};
 
 	auto ensure_space_func = [&](bool only_if_not_newline = false) {
-		if (!line.ends_with(" ") && (!only_if_not_newline || (prev_token != G_TK_NEWLINE))) {
+		if (!line.ends_with(' ') && (!only_if_not_newline || (prev_token != G_TK_NEWLINE))) {
 			line += " ";
 		}
 	};
 
 	auto ensure_ending_space_func([&](int idx) {
 		if (
-				!line.ends_with(" ") && idx < tokens.size() - 1 &&
-				(get_global_token(tokens[idx + 1]) != G_TK_NEWLINE &&
+				!line.ends_with(' ') && idx < tokens.size() - 1 &&
+				(global_tokens[idx + 1] != G_TK_NEWLINE &&
 						!check_new_line(idx + 1))) {
 			line += " ";
 		}
@@ -726,7 +792,7 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 
 	for (int i = 0; i < tokens.size(); i++) {
 		uint32_t local_token = tokens[i] & TOKEN_MASK;
-		GlobalToken curr_token = get_global_token(local_token);
+		GlobalToken curr_token = global_tokens[i];
 		int curr_line = get_line_func(i);
 		int curr_column = get_col_func(i);
 		if (curr_token != G_TK_NEWLINE && curr_line != prev_line && curr_line != 0) {
@@ -966,7 +1032,7 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 				line += "const ";
 			} break;
 			case G_TK_PR_VAR: {
-				if (line != String() && prev_token != G_TK_PR_ONREADY)
+				if (!line.is_empty() && prev_token != G_TK_PR_ONREADY)
 					line += " ";
 				line += "var ";
 			} break;
@@ -1151,13 +1217,13 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 	}
 
 	if (!line.is_empty()) {
-		for (int j = 0; j < indent; j++) {
-			script_text += use_spaces ? " " : "\t";
-		}
-		script_text += line + "\n";
+		text.append_repeat(use_spaces ? ' ' : '\t', indent);
+		text.append(line);
+		text += "\n";
 	}
 
-	if (script_text == String()) {
+	script_text = text.as_string();
+	if (script_text.is_empty()) {
 		if (identifiers.size() == 0 && constants.size() == 0 && tokens.size() == 0) {
 			return OK;
 		}
@@ -1188,8 +1254,8 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 
 	Vector<StringName> newidentifiers;
 	Vector<Variant> newconstants;
-	VMap<uint32_t, uint32_t> newlines;
-	VMap<uint32_t, uint32_t> newcolumns;
+	Vector<uint32_t> newlines;
+	Vector<uint32_t> newcolumns;
 
 	Vector<uint32_t> newtokens;
 	new_err = get_ids_consts_tokens(recompiled_bytecode, newidentifiers, newconstants, newtokens, newlines, newcolumns);
@@ -1251,11 +1317,11 @@ Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
 			discontinuity = continuity_tester<Vector<uint32_t>>(tokens, newtokens, "Tokens", discontinuity + 1);
 		}
 	}
-	auto lines_Size = lines.size();
+	auto lines_Size = script_state.lines.size();
 	auto newlines_Size = newlines.size();
-	discontinuity = continuity_tester<VMap<uint32_t, uint32_t>>(lines, newlines, "Lines");
+	discontinuity = continuity_tester<Vector<uint32_t>>(script_state.lines, newlines, "Lines");
 	if (discontinuity != -1 && discontinuity < lines_Size && discontinuity < newlines_Size) {
-		WARN_PRINT("Different Lines: " + itos(lines[discontinuity]) + " != " + itos(newlines[discontinuity]));
+		WARN_PRINT("Different Lines: " + itos(script_state.lines[discontinuity]) + " != " + itos(newlines[discontinuity]));
 	}
 
 	new_err = decomp->decompile_buffer(recompiled_bytecode);
@@ -1278,6 +1344,23 @@ GDScriptDecomp::BytecodeTestResult GDScriptDecomp::test_bytecode(Vector<uint8_t>
 	return _test_bytecode(p_buffer, p_token_max, p_func_max, print_verbose);
 }
 
+Error GDScriptDecomp::get_script_fingerprint(const Vector<uint8_t> &p_buffer, int &r_token_max, int &r_func_max) {
+	ScriptState script_state;
+	Error err = get_script_state(p_buffer, script_state);
+	if (err) {
+		return err;
+	}
+	int builtin_func_token = get_local_token_val(G_TK_BUILT_IN_FUNC);
+	for (uint32_t token : script_state.tokens) {
+		int local_token = token & TOKEN_MASK;
+		r_token_max = MAX(r_token_max, local_token);
+		if (local_token == builtin_func_token) {
+			r_func_max = MAX(r_func_max, (int)(token >> TOKEN_BITS));
+		}
+	}
+	return OK;
+}
+
 bool is_whitespace_or_ignorable(GDScriptDecomp::GlobalToken p_token) {
 	switch (p_token) {
 		case GDScriptDecomp::G_TK_INDENT:
@@ -1290,6 +1373,18 @@ bool is_whitespace_or_ignorable(GDScriptDecomp::GlobalToken p_token) {
 	}
 }
 
+void GDScriptDecomp::get_global_tokens(const Vector<uint32_t> &p_tokens, Vector<GlobalToken> &r_global_tokens) const {
+	const GlobalToken *table = get_global_token_table();
+	uint32_t token_max = get_token_max();
+	r_global_tokens.resize(p_tokens.size());
+	GlobalToken *w = r_global_tokens.ptrw();
+	const uint32_t *r = p_tokens.ptr();
+	for (int i = 0; i < p_tokens.size(); i++) {
+		uint32_t local_token = r[i] & TOKEN_MASK;
+		w[i] = local_token < token_max ? table[local_token] : G_TK_MAX;
+	}
+}
+
 bool GDScriptDecomp::check_prev_token(int p_pos, const Vector<uint32_t> &p_tokens, GlobalToken p_token) {
 	if (p_pos == 0) {
 		return false;
@@ -1372,9 +1467,10 @@ GDScriptDecomp::BytecodeTestResult GDScriptDecomp::_test_bytecode(Vector<uint8_t
 	Vector<StringName> &identifiers = script_state.identifiers;
 	Vector<Variant> &constants = script_state.constants;
 	Vector<uint32_t> &tokens = script_state.tokens;
-	VMap<uint32_t, uint32_t> &lines = script_state.lines;
-	VMap<uint32_t, uint32_t> &columns = script_state.columns;
+	Vector<uint32_t> &columns = script_state.columns;
 	int version = script_state.bytecode_version;
+	Vector<GlobalToken> global_tokens;
+	get_global_tokens(tokens, global_tokens);
 	int bytecode_version = get_bytecode_version();
 	int FUNC_MAX = get_function_count();
 
@@ -1384,15 +1480,12 @@ GDScriptDecomp::BytecodeTestResult GDScriptDecomp::_test_bytecode(Vector<uint8_t
 
 	ERR_FAIL_COND_V_MSG(err != OK, BYTECODE_TEST_CORRUPT, "Failed to get identifiers, constants, and tokens");
 	auto get_line_func([&](int i) {
-		if (lines.has(i)) {
-			return lines[i];
-		}
-		return 0U;
+		return script_state.get_line(i);
 	});
 
 	for (int i = 0; i < tokens.size(); i++) {
 		r_tok_max = MAX(r_tok_max, tokens[i] & TOKEN_MASK);
-		GlobalToken curr_token = get_global_token(tokens[i]);
+		GlobalToken curr_token = global_tokens[i];
 		Pair<int, int> arg_count;
 		bool test_func = false;
 		int func_id = -1;
@@ -1408,8 +1501,8 @@ GDScriptDecomp::BytecodeTestResult GDScriptDecomp::_test_bytecode(Vector<uint8_t
 				SIZE_CHECK(2);
 				// ignore the next_token because it can be anything
 				// get the one after
-				GlobalToken next_token = get_global_token(tokens[i + 1]);
-				GlobalToken nextnext_token = get_global_token(tokens[i + 2]);
+				GlobalToken next_token = global_tokens[i + 1];
+				GlobalToken nextnext_token = global_tokens[i + 2];
 				if (nextnext_token != G_TK_PARENTHESIS_OPEN && (bytecode_version < GDSCRIPT_2_0_VERSION || next_token != G_TK_PARENTHESIS_OPEN)) {
 					ERR_TEST_FAILED(String("Function declaration error: ") + g_token_str[curr_token] + " " + g_token_str[next_token] + " " + g_token_str[nextnext_token]);
 				}
@@ -1419,7 +1512,7 @@ GDScriptDecomp::BytecodeTestResult GDScriptDecomp::_test_bytecode(Vector<uint8_t
 					// next token has to be EOF, semicolon, or newline
 					SIZE_CHECK(1);
 
-					GlobalToken next_token = get_global_token(tokens[i + 1]);
+					GlobalToken next_token = global_tokens[i + 1];
 					if (next_token != G_TK_NEWLINE && next_token != G_TK_SEMICOLON && next_token != G_TK_EOF) {
 						ERR_TEST_FAILED(String("Pass statement error, next token isn't newline, semicolon, or EOF: ") + g_token_str[next_token]);
 					}
@@ -1428,7 +1521,7 @@ GDScriptDecomp::BytecodeTestResult GDScriptDecomp::_test_bytecode(Vector<uint8_t
 			case G_TK_PR_STATIC: {
 				SIZE_CHECK(1);
 				// STATIC requires TK_PR_FUNCTION as the next token
-				GlobalToken next_token = get_global_token(tokens[i + 1]);
+				GlobalToken next_token = global_tokens[i + 1];
 				if (next_token != G_TK_PR_FUNCTION && (bytecode_version < GDSCRIPT_2_0_VERSION || next_token != G_TK_PR_VAR)) {
 					ERR_TEST_FAILED(String("Static declaration error, next token isn't function or var: ") + g_token_str[next_token]);
 				}
@@ -1436,7 +1529,7 @@ GDScriptDecomp::BytecodeTestResult GDScriptDecomp::_test_bytecode(Vector<uint8_t
 			case G_TK_PR_ENUM: { // not added until 2.1.3, but valid for all versions after
 				SIZE_CHECK(1);
 				// ENUM requires TK_IDENTIFIER or TK_CURLY_BRACKET_OPEN as the next token
-				GlobalToken next_token = get_global_token(tokens[i + 1]);
+				GlobalToken next_token = global_tokens[i + 1];
 				if (next_token != G_TK_IDENTIFIER && next_token != G_TK_CURLY_BRACKET_OPEN) {
 					ERR_TEST_FAILED(String("Enum declaration error, next token isn't identifier or curly bracket open: ") + g_token_str[next_token]);
 				}
@@ -1592,8 +1685,8 @@ Error GDScriptDecomp::get_script_strings(const String &p_path, const String &eng
 Error GDScriptDecomp::get_script_strings_from_buf(const Vector<uint8_t> &p_buffer, Vector<String> &r_strings, bool p_include_identifiers) {
 	Vector<StringName> identifiers;
 	Vector<Variant> constants;
-	VMap<uint32_t, uint32_t> lines;
-	VMap<uint32_t, uint32_t> columns;
+	Vector<uint32_t> lines;
+	Vector<uint32_t> columns;
 	Vector<uint32_t> tokens;
 	Error err = get_ids_consts_tokens(p_buffer, identifiers, constants, tokens, lines, columns);
 	ERR_FAIL_COND_V_MSG(err != OK, err, "Error parsing bytecode");
@@ -1611,8 +1704,8 @@ Error GDScriptDecomp::get_script_strings_from_buf(const Vector<uint8_t> &p_buffe
 Vector<String> GDScriptDecomp::get_compile_errors(const Vector<uint8_t> &p_buffer) {
 	Vector<StringName> identifiers;
 	Vector<Variant> constants;
-	VMap<uint32_t, uint32_t> lines;
-	VMap<uint32_t, uint32_t> columns;
+	Vector<uint32_t> lines;
+	Vector<uint32_t> columns;
 	Vector<uint32_t> tokens;
 	int bytecode_version = get_bytecode_version();
 	const uint8_t *buf = p_buffer.ptr();
@@ -1630,10 +1723,8 @@ Vector<String> GDScriptDecomp::get_compile_errors(const Vector<uint8_t> &p_buffe
 
 	for (int i = 0; i < tokens.size(); i++) {
 		GlobalToken curr_token = get_global_token(tokens[i]);
-		if (lines.has(i)) {
-			if (lines[i] != prev_line && lines[i] != 0) {
-				prev_line = lines[i];
-			}
+		if (i < lines.size() && lines[i] != prev_line && lines[i] != 0) {
+			prev_line = lines[i];
 		}
 		switch (curr_token) {
 			case G_TK_ERROR: {
@@ -1847,6 +1938,75 @@ Vector<uint8_t> GDScriptDecomp::compile_code_string(const String &p_code) {
 	return buf;
 }
 
+namespace {
+struct CompileTask {
+	const String *files = nullptr;
+	String output_dir;
+	// One per worker thread, plus one for any other thread at the end
+	Vector<Ref<GDScriptDecomp>> decomps;
+	String *errors = nullptr;
+};
+
+void compile_file(void *p_userdata, uint32_t p_index) {
+	CompileTask *task = (CompileTask *)p_userdata;
+	const String &file = task->files[p_index];
+	String &error = task->errors[p_index];
+	int thread_idx = WorkerThreadPool::get_singleton()->get_thread_index();
+	const Ref<GDScriptDecomp> &decomp = task->decomps[thread_idx >= 0 && thread_idx < task->decomps.size() - 1 ? thread_idx : task->decomps.size() - 1];
+	if (file.get_extension().to_lower() != "gd") {
+		error = "not a GDScript file";
+		return;
+	}
+	Error err;
+	String code = FileAccess::get_file_as_string(file, &err);
+	if (err != OK) {
+		error = "failed to read file";
+		return;
+	}
+	Vector<uint8_t> bytecode = decomp->compile_code_string(code);
+	if (bytecode.is_empty()) {
+		error = decomp->get_error_message();
+		return;
+	}
+	String out_file = task->output_dir.path_join(file.get_file().get_basename() + ".gdc");
+	Ref<FileAccess> f = FileAccess::open(out_file, FileAccess::WRITE, &err);
+	if (f.is_null()) {
+		error = "failed to open " + out_file + " for writing";
+		return;
+	}
+	if (!f->store_buffer(bytecode)) {
+		error = "failed to write " + out_file;
+	}
+}
+} // namespace
+
+Vector<String> GDScriptDecomp::compile_files(const Vector<String> &p_files, const String &p_output_dir) {
+	Vector<String> errors;
+	if (p_files.is_empty()) {
+		return errors;
+	}
+	errors.resize(p_files.size());
+	CompileTask task;
+	task.files = p_files.ptr();
+	task.output_dir = p_output_dir;
+	task.errors = errors.ptrw();
+	// compile_code_string keeps its error message in the decompiler, so every thread needs its own
+	int thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	for (int i = 0; i < thread_count + 1; i++) {
+		task.decomps.push_back(create_decomp_for_commit(get_bytecode_rev()));
+	}
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&compile_file, &task, p_files.size(), -1, true, SNAME("GDScriptDecomp::compile_files"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	Vector<String> report;
+	for (int i = 0; i < p_files.size(); i++) {
+		if (!errors[i].is_empty()) {
+			report.push_back(p_files[i] + ": " + errors[i]);
+		}
+	}
+	return report;
+}
+
 Vector<String> GDScriptDecomp::get_bytecode_versions() {
 	auto vers = get_decomp_versions();
 	Vector<String> ret;
@@ -1870,8 +2030,7 @@ Ref<GDScriptDecomp> GDScriptDecomp::create_decomp_for_version(String str_ver, bo
 	if (include_dev) {
 		str_ver = ver->as_tag();
 		for (auto &v : versions) {
-			bool has_max = !v.max_version.is_empty();
-			if (v.min_version == str_ver || (has_max && v.max_version == str_ver)) {
+			if (v.min_version == str_ver || (v.has_max_version() && v.max_version == str_ver)) {
 				return Ref<GDScriptDecomp>(create_decomp_for_commit(v.commit));
 			}
 		}
@@ -1888,7 +2047,7 @@ Ref<GDScriptDecomp> GDScriptDecomp::create_decomp_for_version(String str_ver, bo
 			return Ref<GDScriptDecomp>(create_decomp_for_commit(curr_version.commit));
 		}
 
-		if (ver->gt(min_ver) && !curr_version.max_version.is_empty()) {
+		if (ver->gt(min_ver) && curr_version.has_max_version()) {
 			Ref<GodotVer> max_ver = curr_version.get_max_version();
 			if (ver->lte(max_ver)) {
 				return Ref<GDScriptDecomp>(create_decomp_for_commit(curr_version.commit));
@@ -145,6 +145,31 @@ public:
 		G_TK_BACKTICK, // added in 4.3
 		G_TK_MAX,
 	};
+	// Reverse of a generated class's local -> global token table, built at compile time; -1 where the global token doesn't exist.
+	struct LocalTokenTable {
+		int values[G_TK_MAX + 1] = {};
+		template <size_t N>
+		constexpr LocalTokenTable(const GlobalToken (&p_global_tokens)[N]) {
+			for (int i = 0; i <= G_TK_MAX; i++) {
+				values[i] = -1;
+			}
+			for (size_t i = 0; i < N; i++) {
+				values[p_global_tokens[i]] = (int)i;
+			}
+		}
+	};
+
+	// Hash used by the generated perfect-hash tables of builtin function names; must match `hash_function_name` in bytecode_generator.py
+	static _FORCE_INLINE_ uint32_t hash_function_name(const String &p_name, uint32_t p_seed) {
+		uint32_t hash = 2166136261u ^ p_seed;
+		const char32_t *chr = p_name.ptr();
+		for (int i = 0; i < p_name.length(); i++) {
+			hash ^= (uint32_t)chr[i];
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
 	enum BytecodeTestResult {
 		BYTECODE_TEST_PASS,
 		BYTECODE_TEST_FAIL,
@@ -165,9 +190,14 @@ public:
 		Vector<StringName> identifiers;
 		Vector<Variant> constants;
 		Vector<uint32_t> tokens;
-		VMap<uint32_t, uint32_t> lines;
-		VMap<uint32_t, uint32_t> columns;
+		// Indexed by token position; 0 if the token has no line/column recorded.
+		// `columns` is left empty for bytecode that doesn't store columns (i.e. pre-2.0).
+		Vector<uint32_t> lines;
+		Vector<uint32_t> columns;
 		HashSet<String> dependencies;
+
+		_FORCE_INLINE_ uint32_t get_line(int p_token) const { return p_token < lines.size() ? lines[p_token] : 0; }
+		_FORCE_INLINE_ uint32_t get_column(int p_token) const { return p_token < columns.size() ? columns[p_token] : 0; }
 	};
 
 protected:
@@ -185,9 +215,9 @@ protected:
 	bool check_prev_token(int p_pos, const Vector<uint32_t> &p_tokens, GlobalToken p_token);
 	bool is_token_func_call(int p_pos, const Vector<uint32_t> &p_tokens);
 	bool is_token_builtin_func(int p_pos, const Vector<uint32_t> &p_tokens);
-	Error get_ids_consts_tokens(const Vector<uint8_t> &p_buffer, Vector<StringName> &r_identifiers, Vector<Variant> &r_constants, Vector<uint32_t> &r_tokens, VMap<uint32_t, uint32_t> &lines, VMap<uint32_t, uint32_t> &columns);
+	Error get_ids_consts_tokens(const Vector<uint8_t> &p_buffer, Vector<StringName> &r_identifiers, Vector<Variant> &r_constants, Vector<uint32_t> &r_tokens, Vector<uint32_t> &r_lines, Vector<uint32_t> &r_columns);
 	// GDScript version 2.0
-	Error get_ids_consts_tokens_v2(const Vector<uint8_t> &p_buffer, int bytecode_version, Vector<StringName> &r_identifiers, Vector<Variant> &r_constants, Vector<uint32_t> &r_tokens, VMap<uint32_t, uint32_t> &lines, VMap<uint32_t, uint32_t> &columns);
+	Error get_ids_consts_tokens_v2(const Vector<uint8_t> &p_buffer, int bytecode_version, Vector<StringName> &r_identifiers, Vector<Variant> &r_constants, Vector<uint32_t> &r_tokens, Vector<uint32_t> &r_lines, Vector<uint32_t> &r_columns);
 
 	Error get_script_state(const Vector<uint8_t> &p_buffer, ScriptState &r_state);
 
@@ -197,6 +227,10 @@ public:
 	virtual Error decompile_buffer(Vector<uint8_t> p_buffer);
 	virtual BytecodeTestResult _test_bytecode(Vector<uint8_t> p_buffer, int &p_token_max, int &p_func_max, bool print_verbose = false);
 	BytecodeTestResult test_bytecode(Vector<uint8_t> p_buffer, bool print_verbose = false);
+	// Highest local token and builtin function index used by the script (left alone if there are none), without validating anything else.
+	// Builtin functions are found through the revision's TK_BUILT_IN_FUNC, but that is local token 5 in every pre-2.0 revision (2.0 has none),
+	// so the result only depends on the bytecode and variant versions and any revision with the same ones gives the same result.
+	Error get_script_fingerprint(const Vector<uint8_t> &p_buffer, int &r_token_max, int &r_func_max);
 
 	virtual String get_function_name(int p_func) const = 0;
 	virtual int get_function_count() const = 0;
@@ -204,6 +238,10 @@ public:
 	virtual int get_token_max() const = 0;
 	virtual int get_function_index(const String &p_func) const = 0;
 	virtual GDScriptDecomp::GlobalToken get_global_token(int p_token) const = 0;
+	// Local -> global token table, get_token_max() + 1 entries long
+	virtual const GDScriptDecomp::GlobalToken *get_global_token_table() const = 0;
+	// Translates a whole token stream at once; tokens outside of the table become G_TK_MAX
+	void get_global_tokens(const Vector<uint32_t> &p_tokens, Vector<GlobalToken> &r_global_tokens) const;
 	virtual int get_local_token_val(GDScriptDecomp::GlobalToken p_token) const = 0;
 	virtual int get_bytecode_version() const = 0;
 	virtual int get_bytecode_rev() const = 0;
@@ -224,6 +262,8 @@ public:
 	static Ref<GDScriptDecomp> create_decomp_for_commit(uint64_t p_commit_hash);
 	static Ref<GDScriptDecomp> create_decomp_for_version(String ver, bool p_force = false);
 	Vector<uint8_t> compile_code_string(const String &p_code);
+	// Compiles every file into p_output_dir as <name>.gdc on the worker pool; returns an error line for each file that failed.
+	Vector<String> compile_files(const Vector<String> &p_files, const String &p_output_dir);
 	Error debug_print(Vector<uint8_t> p_buffer);
 	static int read_bytecode_version(const String &p_path);
 	static int read_bytecode_version_encrypted(const String &p_path, int engine_ver_major, Vector<uint8_t> p_key);
@@ -2,6 +2,10 @@
 #include "bytecode/bytecode_base.h"
 #include "bytecode/bytecode_versions.h"
 #include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "utility/gdre_settings.h"
 #include "utility/godotver.h"
 
@@ -146,25 +150,17 @@ built-in func divergence for bytecode version 13 (3.1.x only)
 // TODO: add this
 */
 
-int BytecodeTester::get_bytecode_version(const Vector<String> &bytecode_files) {
+int BytecodeTester::get_bytecode_version(const BytecodeSet &p_set) {
 	int bytecode_version = 0;
-	if (bytecode_files.size() == 0) {
-		return bytecode_version;
+	if (p_set.encryption_error) {
+		return -2;
 	}
-	for (const String &file : bytecode_files) {
-		int this_ver = 0;
-		if (file.get_extension().to_lower() == "gde") {
-			this_ver = GDScriptDecomp::read_bytecode_version_encrypted(file, 3, GDRESettings::get_singleton()->get_encryption_key());
-		} else {
-			this_ver = GDScriptDecomp::read_bytecode_version(file);
-		}
-		if (this_ver == -2) {
-			return -2; // encryption error
-		}
-		if (this_ver == -1) {
+	for (const Vector<uint8_t> &buffer : p_set.buffers) {
+		if (buffer.size() < 24 || buffer[0] != 'G' || buffer[1] != 'D' || buffer[2] != 'S' || buffer[3] != 'C') {
 			// WARN_PRINT("Could not read bytecode version from file: " + file);
 			continue;
 		}
+		int this_ver = decode_uint32(&buffer.ptr()[4]);
 		if (bytecode_version == 0) {
 			bytecode_version = this_ver;
 		} else if (this_ver != bytecode_version) {
@@ -175,12 +171,12 @@ int BytecodeTester::get_bytecode_version(const Vector<String> &bytecode_files) {
 	return bytecode_version;
 }
 
-uint64_t BytecodeTester::generic_test(const Vector<String> &p_paths, int ver_major_hint, int ver_minor_hint, bool include_dev, bool print_log_on_fail) {
-	int detected_bytecode_version = get_bytecode_version(p_paths);
+uint64_t BytecodeTester::generic_test(const BytecodeSet &p_set, int ver_major_hint, int ver_minor_hint, bool include_dev, bool print_log_on_fail) {
+	int detected_bytecode_version = get_bytecode_version(p_set);
 	ERR_FAIL_COND_V_MSG(detected_bytecode_version == -1, {}, "Inconsistent byecode versions across files!!!");
 	ERR_FAIL_COND_V_MSG(detected_bytecode_version <= 0, {}, "Could not read bytecode version from files.");
 
-	Vector<Ref<GDScriptDecomp>> decomp_versions = BytecodeTester::get_possible_decomps(p_paths, include_dev);
+	Vector<Ref<GDScriptDecomp>> decomp_versions = BytecodeTester::get_possible_decomps(p_set, include_dev);
 	if (decomp_versions.size() == 1) {
 		// easy
 		return decomp_versions[0]->get_bytecode_rev();
@@ -188,12 +184,12 @@ uint64_t BytecodeTester::generic_test(const Vector<String> &p_paths, int ver_maj
 	if (decomp_versions.size() == 0) {
 		if (!include_dev) {
 			// try again with the dev versions
-			return generic_test(p_paths, ver_major_hint, ver_minor_hint, true, print_log_on_fail);
+			return generic_test(p_set, ver_major_hint, ver_minor_hint, true, print_log_on_fail);
 		}
 		// else fail
 		if (print_log_on_fail) {
 			// run the tests with print_verbose = true to put out a decent error log of what happened.
-			BytecodeTester::get_possible_decomps(p_paths, include_dev, true);
+			BytecodeTester::get_possible_decomps(p_set, include_dev, true);
 		}
 		ERR_FAIL_V_MSG(0, "Failed to detect GDScript revision for bytecode version " + vformat("%d", detected_bytecode_version) + ", engine version " + vformat("%d.%d", ver_major_hint, ver_minor_hint) + ", please report this issue on GitHub.");
 	}
@@ -224,7 +220,7 @@ uint64_t BytecodeTester::generic_test(const Vector<String> &p_paths, int ver_maj
 	// TODO: Smarter handling for this
 }
 
-uint64_t BytecodeTester::test_files_2_1(const Vector<String> &p_paths) {
+uint64_t BytecodeTester::test_files_2_1(const BytecodeSet &p_set) {
 	uint64_t rev = 0;
 	bool ed80f45_failed = false;
 	bool ed80f45_passed = false;
@@ -237,8 +233,9 @@ uint64_t BytecodeTester::test_files_2_1(const Vector<String> &p_paths) {
 	Ref<GDScriptDecomp_7124599> decomp_7124599 = memnew(GDScriptDecomp_7124599);
 	int func_max = 0;
 	int token_max = 0;
-	for (String path : p_paths) {
-		Vector<uint8_t> data = FileAccess::get_file_as_bytes(path);
+	for (int i = 0; i < p_set.buffers.size(); i++) {
+		const Vector<uint8_t> &data = p_set.buffers[i];
+		const String &path = p_set.files[i];
 		if (data.size() == 0) {
 			continue;
 		}
@@ -334,13 +331,14 @@ uint64_t BytecodeTester::test_files_2_1(const Vector<String> &p_paths) {
 		}
 		if (rev == 0) {
 			// try it with the dev versions.
-			return BytecodeTester::generic_test(p_paths, 2, 1, true, true);
+			return BytecodeTester::generic_test(p_set, 2, 1, true, true);
 		}
 	}
 	return rev;
 }
 
-uint64_t BytecodeTester::test_files_3_1(const Vector<String> &p_paths, const Vector<uint8_t> &p_key) {
+uint64_t BytecodeTester::test_files_3_1(const BytecodeSet &p_set) {
+	ERR_FAIL_COND_V_MSG(p_set.encryption_error, 0, "Failed to decrypt scripts (Did you set the correct key?)");
 	uint64_t rev = 0;
 	bool _514a3fb_failed = false;
 	bool _1a36141_failed = false;
@@ -354,15 +352,9 @@ uint64_t BytecodeTester::test_files_3_1(const Vector<String> &p_paths, const Vec
 	int func_max = 0;
 	int token_max = 0;
 
-	for (String path : p_paths) {
-		Vector<uint8_t> data;
-		if (p_key.size() > 0) {
-			Error err = GDScriptDecomp::get_buffer_encrypted(path, 3, p_key, data);
-			ERR_FAIL_COND_V_MSG(err == ERR_UNAUTHORIZED, 0, "Failed to decrypt file " + path + " (Did you set the correct key?)");
-			ERR_FAIL_COND_V_MSG(err != OK, 0, "Failed to read file " + path);
-		} else {
-			data = FileAccess::get_file_as_bytes(path);
-		}
+	for (int i = 0; i < p_set.buffers.size(); i++) {
+		const Vector<uint8_t> &data = p_set.buffers[i];
+		const String &path = p_set.files[i];
 		if (data.size() == 0) {
 			continue;
 		}
@@ -463,7 +455,7 @@ uint64_t BytecodeTester::test_files_3_1(const Vector<String> &p_paths, const Vec
 			rev = 0x1ca61a3;
 		} else {
 			// Try it with the dev versions.
-			return generic_test(p_paths, 3, 1, true, true);
+			return generic_test(p_set, 3, 1, true, true);
 		}
 	}
 
@@ -473,63 +465,224 @@ uint64_t BytecodeTester::test_files_3_1(const Vector<String> &p_paths, const Vec
 uint64_t BytecodeTester::test_files(const Vector<String> &p_paths, int ver_major_hint, int ver_minor_hint, bool print_log_on_fail) {
 	uint64_t rev = 0;
 	ERR_FAIL_COND_V_MSG(p_paths.size() == 0, 0, "No files to test");
-	Vector<uint8_t> key;
-	if (p_paths[0].get_extension().to_lower() == "gde") {
-		key = GDRESettings::get_singleton()->get_encryption_key();
-	}
+	BytecodeSet set = load_bytecode_set(p_paths);
 
 	if (ver_major_hint == 3 && ver_minor_hint == 1) {
-		rev = test_files_3_1(p_paths, key);
+		rev = test_files_3_1(set);
 	} else if (ver_major_hint == 2 && ver_minor_hint == 1) {
-		rev = test_files_2_1(p_paths);
+		rev = test_files_2_1(set);
 	} else {
-		rev = generic_test(p_paths, ver_major_hint, ver_minor_hint, false, print_log_on_fail);
+		rev = generic_test(set, ver_major_hint, ver_minor_hint, false, print_log_on_fail);
 	}
 	return rev;
 }
 
-Vector<Ref<GDScriptDecomp>> get_possibles_from_set(const Vector<String> &bytecode_files, const Vector<Ref<GDScriptDecomp>> &decomps, bool print_verbosely = false) {
-	Vector<Ref<GDScriptDecomp>> passed;
+namespace {
+struct BytecodeLoadTask {
+	const String *files = nullptr;
+	Vector<uint8_t> *buffers = nullptr;
+	Vector<uint8_t> key;
+	std::atomic<bool> encryption_error = false;
+};
+
+void load_bytecode_file(void *p_userdata, uint32_t p_index) {
+	BytecodeLoadTask *task = (BytecodeLoadTask *)p_userdata;
+	const String &file = task->files[p_index];
+	Vector<uint8_t> &buffer = task->buffers[p_index];
+	if (file.get_extension().to_lower() == "gde") {
+		Error err = GDScriptDecomp::get_buffer_encrypted(file, 3, task->key, buffer);
+		if (err) {
+			if (err == ERR_UNAUTHORIZED) {
+				task->encryption_error = true;
+			}
+			WARN_PRINT("Could not read encrypted bytecode file: " + file);
+			buffer.clear();
+		}
+	} else {
+		buffer = FileAccess::get_file_as_bytes(file);
+		if (buffer.size() == 0) {
+			WARN_PRINT("Could not read bytecode file: " + file);
+		}
+	}
+}
 
-	for (const auto &decomp : decomps) {
-		bool failed = false;
-		for (const String &file : bytecode_files) {
-			Vector<uint8_t> buffer;
-			if (file.get_extension().to_lower() == "gde") {
-				Error err = GDScriptDecomp::get_buffer_encrypted(file, 3, GDRESettings::get_singleton()->get_encryption_key(), buffer);
-				if (err) {
-					WARN_PRINT("Could not read encrypted bytecode file: " + file);
-					continue;
-				}
-			} else {
-				buffer = FileAccess::get_file_as_bytes(file);
-				if (buffer.size() == 0) {
-					WARN_PRINT("Could not read bytecode file: " + file);
-					continue;
-				}
+struct CandidateTestTask {
+	const BytecodeTester::BytecodeSet *set = nullptr;
+	const GDScriptDecompVersion *const *versions = nullptr;
+	// Only the candidates that pass get to keep their decompiler
+	Ref<GDScriptDecomp> *passed = nullptr;
+	bool print_verbosely = false;
+	// The script that most recently ruled out a candidate; neighbouring revisions tend to trip over the same one, so it's tested first
+	std::atomic<int> last_failed = 0;
+};
+
+void test_candidate(void *p_userdata, uint32_t p_index) {
+	CandidateTestTask *task = (CandidateTestTask *)p_userdata;
+	Ref<GDScriptDecomp> decomp = Ref<GDScriptDecomp>(task->versions[p_index]->create());
+	const Vector<Vector<uint8_t>> &buffers = task->set->buffers;
+	auto fails = [&](int i) {
+		if (buffers[i].is_empty()) {
+			return false;
+		}
+		auto result = decomp->test_bytecode(buffers[i], task->print_verbosely);
+		if (result == GDScriptDecomp::BYTECODE_TEST_FAIL || result == GDScriptDecomp::BYTECODE_TEST_CORRUPT) {
+			if (task->print_verbosely) {
+				print_line("\t Test failed on file " + task->set->files[i]);
 			}
-			auto result = decomp->test_bytecode(buffer, print_verbosely);
-			if (result == GDScriptDecomp::BYTECODE_TEST_FAIL || result == GDScriptDecomp::BYTECODE_TEST_CORRUPT) {
-				if (print_verbosely) {
-					print_line("\t Test failed on file " + file);
-				}
-				failed = true;
-				break;
+			return true;
+		}
+		return false;
+	};
+	int first = task->last_failed;
+	if (fails(first)) {
+		return;
+	}
+	for (int i = 0; i < buffers.size(); i++) {
+		if (i != first && fails(i)) {
+			task->last_failed = i;
+			return;
+		}
+	}
+	task->passed[p_index] = decomp;
+}
+
+struct FingerprintTask {
+	const BytecodeTester::BytecodeSet *set = nullptr;
+	// decompilers aren't thread-safe, so there's one per worker thread, plus one for any other thread at the end
+	LocalVector<Ref<GDScriptDecomp>> decomps;
+	std::atomic<int> token_max = -1;
+	std::atomic<int> func_max = -1;
+	std::atomic<bool> failed = false;
+};
+
+void fingerprint_script(void *p_userdata, uint32_t p_index) {
+	FingerprintTask *task = (FingerprintTask *)p_userdata;
+	const Vector<uint8_t> &buffer = task->set->buffers[p_index];
+	if (buffer.is_empty() || task->failed) {
+		return;
+	}
+	int thread_idx = WorkerThreadPool::get_singleton()->get_thread_index();
+	const Ref<GDScriptDecomp> &decomp = task->decomps[thread_idx >= 0 && thread_idx < (int)task->decomps.size() - 1 ? thread_idx : task->decomps.size() - 1];
+	int token_max = -1;
+	int func_max = -1;
+	if (decomp->get_script_fingerprint(buffer, token_max, func_max) != OK) {
+		task->failed = true;
+		return;
+	}
+	int prev = task->token_max;
+	while (token_max > prev && !task->token_max.compare_exchange_weak(prev, token_max)) {
+	}
+	prev = task->func_max;
+	while (func_max > prev && !task->func_max.compare_exchange_weak(prev, func_max)) {
+	}
+}
+
+// Rules out every candidate that can't possibly hold the scripts' tokens and builtin functions, with a single scan of the scripts.
+// Revisions of the same bytecode version mostly differ by tokens or functions added at the end of their lists, so this usually leaves only a few to validate.
+void narrow_candidates(const BytecodeTester::BytecodeSet &p_set, LocalVector<const GDScriptDecompVersion *> &r_versions) {
+	if (p_set.buffers.is_empty() || r_versions.size() < 2) {
+		return;
+	}
+	// Parsing constants depends on the variant version, which isn't always the same within a bytecode version
+	HashMap<int, Pair<int, int>> fingerprints;
+	LocalVector<const GDScriptDecompVersion *> narrowed;
+	for (const GDScriptDecompVersion *version : r_versions) {
+		if (!fingerprints.has(version->variant_ver_major)) {
+			FingerprintTask task;
+			task.set = &p_set;
+			int thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+			for (int i = 0; i < thread_count + 1; i++) {
+				task.decomps.push_back(Ref<GDScriptDecomp>(version->create()));
 			}
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&fingerprint_script, &task, p_set.buffers.size(), -1, true, SNAME("BytecodeTester::narrow_candidates"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			// If we can't scan the scripts, let the full tests sort it out
+			fingerprints.insert(version->variant_ver_major, task.failed ? Pair<int, int>(-1, -1) : Pair<int, int>(task.token_max, task.func_max));
+		}
+		const Pair<int, int> &fingerprint = fingerprints[version->variant_ver_major];
+		if (fingerprint.first < version->token_max && fingerprint.second < version->function_count) {
+			narrowed.push_back(version);
+		}
+	}
+	r_versions = narrowed;
+}
+
+Vector<Ref<GDScriptDecomp>> get_possibles_from_set(const BytecodeTester::BytecodeSet &p_set, const LocalVector<const GDScriptDecompVersion *> &versions, bool print_verbosely = false) {
+	Vector<Ref<GDScriptDecomp>> passed;
+	if (p_set.buffers.is_empty()) {
+		for (const GDScriptDecompVersion *version : versions) {
+			passed.push_back(Ref<GDScriptDecomp>(version->create()));
+		}
+		return passed;
+	}
+	LocalVector<Ref<GDScriptDecomp>> results;
+	results.resize(versions.size());
+	CandidateTestTask task;
+	task.set = &p_set;
+	task.versions = versions.ptr();
+	task.passed = results.ptr();
+	task.print_verbosely = print_verbosely;
+	// Keep the log readable when we're printing out why each candidate failed
+	if (print_verbosely || versions.size() < 2) {
+		for (uint32_t i = 0; i < versions.size(); i++) {
+			test_candidate(&task, i);
 		}
-		if (!failed) {
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&test_candidate, &task, versions.size(), -1, true, SNAME("BytecodeTester::get_possibles_from_set"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+	for (const Ref<GDScriptDecomp> &decomp : results) {
+		if (decomp.is_valid()) {
 			passed.append(decomp);
 		}
 	}
 	return passed;
 }
+} //namespace
+
+BytecodeTester::BytecodeSet BytecodeTester::load_bytecode_set(const Vector<String> &p_paths) {
+	BytecodeSet set;
+	set.files = p_paths;
+	set.buffers.resize(p_paths.size());
+	if (p_paths.is_empty()) {
+		return set;
+	}
+	BytecodeLoadTask task;
+	task.files = set.files.ptr();
+	task.buffers = set.buffers.ptrw();
+	for (const String &file : p_paths) {
+		if (file.get_extension().to_lower() == "gde") {
+			task.key = GDRESettings::get_singleton()->get_encryption_key();
+			break;
+		}
+	}
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&load_bytecode_file, &task, p_paths.size(), -1, true, SNAME("BytecodeTester::load_bytecode_set"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	set.encryption_error = task.encryption_error;
+	return set;
+}
 
 Vector<Ref<GDScriptDecomp>> BytecodeTester::get_possible_decomps(Vector<String> bytecode_files, bool include_dev, bool print_verbosely) {
-	int bytecode_version = get_bytecode_version(bytecode_files);
+	return get_possible_decomps(load_bytecode_set(bytecode_files), include_dev, print_verbosely);
+}
+
+Vector<Ref<GDScriptDecomp>> BytecodeTester::get_possible_decomps(const BytecodeSet &p_set, bool include_dev, bool print_verbosely) {
+	int bytecode_version = get_bytecode_version(p_set);
 	ERR_FAIL_COND_V_MSG(bytecode_version == -1, {}, "Inconsistent bytecode versions across files!!!");
 	ERR_FAIL_COND_V_MSG(bytecode_version <= 0, {}, "Could not read bytecode version from files.");
-	auto decomps = get_decomps_for_bytecode_ver(bytecode_version, include_dev);
-	return get_possibles_from_set(bytecode_files, decomps, print_verbosely);
+	// Candidates are picked from the registry; their decompilers are only created when they're tested
+	LocalVector<const GDScriptDecompVersion *> versions;
+	for (int i = 0; i < num_decomp_versions; i++) {
+		const GDScriptDecompVersion &version = decomp_versions[i];
+		if (version.create && version.bytecode_version == bytecode_version && (include_dev || !version.is_dev)) {
+			versions.push_back(&version);
+		}
+	}
+	// When we're printing out why candidates failed, we want the full tests for all of them
+	if (!print_verbosely) {
+		narrow_candidates(p_set, versions);
+	}
+	return get_possibles_from_set(p_set, versions, print_verbosely);
 }
 
 Vector<Ref<GDScriptDecomp>> BytecodeTester::filter_decomps(const Vector<Ref<GDScriptDecomp>> &decomp_versions, int ver_major_hint, int ver_minor_hint) {
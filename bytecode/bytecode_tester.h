@@ -5,13 +5,25 @@
 #include "core/templates/vector.h"
 
 class BytecodeTester {
-	static int get_bytecode_version(const Vector<String> &bytecode_files);
-	static uint64_t generic_test(const Vector<String> &p_paths, int ver_major_hint, int ver_minor_hint, bool include_dev = false, bool print_verbosely = false);
-	static uint64_t test_files_2_1(const Vector<String> &p_paths);
-	static uint64_t test_files_3_1(const Vector<String> &p_paths, const Vector<uint8_t> &p_key = Vector<uint8_t>());
+public:
+	// Scripts read (and decrypted) once, then shared by every revision test.
+	// Scripts that couldn't be read are left empty and skipped.
+	struct BytecodeSet {
+		Vector<String> files;
+		Vector<Vector<uint8_t>> buffers;
+		bool encryption_error = false;
+	};
+
+private:
+	static int get_bytecode_version(const BytecodeSet &p_set);
+	static uint64_t generic_test(const BytecodeSet &p_set, int ver_major_hint, int ver_minor_hint, bool include_dev = false, bool print_verbosely = false);
+	static uint64_t test_files_2_1(const BytecodeSet &p_set);
+	static uint64_t test_files_3_1(const BytecodeSet &p_set);
 
 public:
+	static BytecodeSet load_bytecode_set(const Vector<String> &p_paths);
 	static uint64_t test_files(const Vector<String> &p_paths, int ver_major_hint = -1, int ver_minor_hint = -1, bool print_verbosely = false);
 	static Vector<Ref<GDScriptDecomp>> filter_decomps(const Vector<Ref<GDScriptDecomp>> &decomps, int ver_major_hint, int ver_minor_hint);
 	static Vector<Ref<GDScriptDecomp>> get_possible_decomps(Vector<String> bytecode_files, bool include_dev = false, bool print_verbosely = false);
-};
\ No newline at end of file
+	static Vector<Ref<GDScriptDecomp>> get_possible_decomps(const BytecodeSet &p_set, bool include_dev = false, bool print_verbosely = false);
+};
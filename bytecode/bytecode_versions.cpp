@@ -64,73 +64,28 @@ void register_decomp_versions() {
 
 }
 
-GDScriptDecomp *create_decomp_for_commit(uint64_t p_commit_hash) {
-	switch (p_commit_hash) {
-		case 0x77af6ca: return memnew(GDScriptDecomp_77af6ca);
-		case 0xf3f05dc: return memnew(GDScriptDecomp_f3f05dc);
-		case 0x506df14: return memnew(GDScriptDecomp_506df14);
-		case 0xa7aad78: return memnew(GDScriptDecomp_a7aad78);
-		case 0x5565f55: return memnew(GDScriptDecomp_5565f55);
-		case 0x6694c11: return memnew(GDScriptDecomp_6694c11);
-		case 0xa60f242: return memnew(GDScriptDecomp_a60f242);
-		case 0xc00427a: return memnew(GDScriptDecomp_c00427a);
-		case 0x620ec47: return memnew(GDScriptDecomp_620ec47);
-		case 0x7f7d97f: return memnew(GDScriptDecomp_7f7d97f);
-		case 0x514a3fb: return memnew(GDScriptDecomp_514a3fb);
-		case 0x1a36141: return memnew(GDScriptDecomp_1a36141);
-		case 0x1ca61a3: return memnew(GDScriptDecomp_1ca61a3);
-		case 0xd6b31da: return memnew(GDScriptDecomp_d6b31da);
-		case 0x8aab9a0: return memnew(GDScriptDecomp_8aab9a0);
-		case 0xa3f1ee5: return memnew(GDScriptDecomp_a3f1ee5);
-		case 0x8e35d93: return memnew(GDScriptDecomp_8e35d93);
-		case 0x3ea6d9f: return memnew(GDScriptDecomp_3ea6d9f);
-		case 0xa56d6ff: return memnew(GDScriptDecomp_a56d6ff);
-		case 0xff1e7cf: return memnew(GDScriptDecomp_ff1e7cf);
-		case 0x054a2ac: return memnew(GDScriptDecomp_054a2ac);
-		case 0x91ca725: return memnew(GDScriptDecomp_91ca725);
-		case 0x216a8aa: return memnew(GDScriptDecomp_216a8aa);
-		case 0xd28da86: return memnew(GDScriptDecomp_d28da86);
-		case 0xc6120e7: return memnew(GDScriptDecomp_c6120e7);
-		case 0x015d36d: return memnew(GDScriptDecomp_015d36d);
-		case 0x5e938f0: return memnew(GDScriptDecomp_5e938f0);
-		case 0xc24c739: return memnew(GDScriptDecomp_c24c739);
-		case 0xf8a7c46: return memnew(GDScriptDecomp_f8a7c46);
-		case 0x62273e5: return memnew(GDScriptDecomp_62273e5);
-		case 0x8b912d1: return memnew(GDScriptDecomp_8b912d1);
-		case 0x23381a5: return memnew(GDScriptDecomp_23381a5);
-		case 0x513c026: return memnew(GDScriptDecomp_513c026);
-		case 0x4ee82a2: return memnew(GDScriptDecomp_4ee82a2);
-		case 0x1add52b: return memnew(GDScriptDecomp_1add52b);
-		case 0xed80f45: return memnew(GDScriptDecomp_ed80f45);
-		case 0x85585c7: return memnew(GDScriptDecomp_85585c7);
-		case 0x7124599: return memnew(GDScriptDecomp_7124599);
-		case 0x23441ec: return memnew(GDScriptDecomp_23441ec);
-		case 0x6174585: return memnew(GDScriptDecomp_6174585);
-		case 0x64872ca: return memnew(GDScriptDecomp_64872ca);
-		case 0x7d2d144: return memnew(GDScriptDecomp_7d2d144);
-		case 0x30c1229: return memnew(GDScriptDecomp_30c1229);
-		case 0x48f1d02: return memnew(GDScriptDecomp_48f1d02);
-		case 0x65d48d6: return memnew(GDScriptDecomp_65d48d6);
-		case 0xbe46be7: return memnew(GDScriptDecomp_be46be7);
-		case 0x97f34a1: return memnew(GDScriptDecomp_97f34a1);
-		case 0x2185c01: return memnew(GDScriptDecomp_2185c01);
-		case 0xe82dc40: return memnew(GDScriptDecomp_e82dc40);
-		case 0x8cab401: return memnew(GDScriptDecomp_8cab401);
-		case 0x703004f: return memnew(GDScriptDecomp_703004f);
-		case 0x31ce3c5: return memnew(GDScriptDecomp_31ce3c5);
-		case 0x8c1731b: return memnew(GDScriptDecomp_8c1731b);
-		case 0x0b806ee: return memnew(GDScriptDecomp_0b806ee);
+const GDScriptDecompVersion *get_decomp_version(uint64_t p_commit_hash) {
+	for (int i = 0; i < num_decomp_versions; i++) {
+		if (decomp_versions[i].commit == p_commit_hash && decomp_versions[i].create) {
+			return &decomp_versions[i];
+		}
+	}
+	return nullptr;
+}
 
-		default:
-			return nullptr;
+GDScriptDecomp *create_decomp_for_commit(uint64_t p_commit_hash) {
+	const GDScriptDecompVersion *version = get_decomp_version(p_commit_hash);
+	if (!version) {
+		return nullptr;
 	}
+	return version->create();
 }
 
 Vector<Ref<GDScriptDecomp>> get_decomps_for_bytecode_ver(int bytecode_version, bool include_dev) {
 	Vector<Ref<GDScriptDecomp>> decomps;
 	for (int i = 0; i < num_decomp_versions; i++) {
-		if (decomp_versions[i].bytecode_version == bytecode_version && (include_dev || !decomp_versions[i].is_dev)) {
-			decomps.push_back(Ref<GDScriptDecomp>(create_decomp_for_commit(decomp_versions[i].commit)));
+		if (decomp_versions[i].bytecode_version == bytecode_version && decomp_versions[i].create && (include_dev || !decomp_versions[i].is_dev)) {
+			decomps.push_back(Ref<GDScriptDecomp>(decomp_versions[i].create()));
 		}
 	}
 	return decomps;
@@ -138,18 +93,17 @@ Vector<Ref<GDScriptDecomp>> get_decomps_for_bytecode_ver(int bytecode_version, b
 
 Vector<GDScriptDecompVersion> get_decomp_versions(bool include_dev, int ver_major) {
 	Vector<GDScriptDecompVersion> versions;
-	String ver_major_str = itos(ver_major);
 	for (int i = 0; i < num_decomp_versions; i++) {
-		if (decomp_versions[i].commit == 0xfffffff || decomp_versions[i].commit == 0x0000000) {
+		if (!decomp_versions[i].create) {
 			continue;
 		}
 		if (!include_dev && decomp_versions[i].is_dev) {
 			continue;
 		}
-		if (ver_major > 0 && decomp_versions[i].min_version[0] != ver_major_str[0]) {
+		if (ver_major > 0 && decomp_versions[i].engine_ver_major != ver_major) {
 			continue;
 		}
-		versions.push_back(GDScriptDecompVersion(decomp_versions[i]));
+		versions.push_back(decomp_versions[i]);
 	}
 	return versions;
 }
@@ -202,44 +202,48 @@ def remove_comments(line: str) -> str:
 # 	return funcs[p_func].second;
 # }
 # ```
-# 5.5) the `get_function_index` function, which is laid out like this:
+# 5.5) the `get_function_index` function, which looks the name up in a perfect-hash table of the function names
+# (see `generate_function_hash_tables` below):
 # ```cpp
+# static constexpr uint32_t func_hash_displacements[] = { ... };
+# static constexpr int16_t func_hash_slots[] = { ... };
 # int <class_name>::get_function_index(const String &p_func) const {
-#   for (int i = 0; i < num_funcs; i++) {
-#     if (funcs[i].first == p_func) {
-#       return i;
-#     }
-#   return -1;
+# 	uint32_t displacement = func_hash_displacements[hash_function_name(p_func, 0) & <bucket_mask>];
+# 	int idx = func_hash_slots[hash_function_name(p_func, displacement) & <slot_mask>];
+# 	if (idx < 0 || funcs[idx].first != p_func) {
+# 		return -1;
+# 	}
+# 	return idx;
 # }
 # ```
-# 6) the `get_global_token` function, which is laid out like this:
+# 6) the token translation tables and the `get_global_token` function, which are laid out like this:
 # ```cpp
+# static constexpr GDScriptDecomp::GlobalToken global_tokens[] = {
+# 	GDScriptDecomp::G_TK_EOF,
+# 	GDScriptDecomp::G_TK_IDENTIFIER,
+# 	[..etc]
+# 	GDScriptDecomp::G_TK_MAX,
+# };
+# static constexpr GDScriptDecomp::LocalTokenTable local_tokens(global_tokens);
+#
+# const GDScriptDecomp::GlobalToken *<class_name>::get_global_token_table() const {
+# 	return global_tokens;
+# }
 # GDScriptDecomp::GlobalToken <class_name>::get_global_token(int p_token) const {
+# 	p_token = p_token & TOKEN_MASK;
 # 	if (p_token < 0 || p_token >= TK_MAX) {
 # 		return GDScriptDecomp::GlobalToken::G_TK_MAX;
 # 	}
-# 	switch(Token(p_token)) {
-# 		case TK_EOF: return GDScriptDecomp::GlobalToken::G_TK_EOF;
-# 		case TK_IDENTIFIER: return GDScriptDecomp::GlobalToken::G_TK_IDENTIFIER;
-# 		case TK_CONSTANT: return GDScriptDecomp::GlobalToken::G_TK_CONSTANT;
-# 		[..etc]
-# 		case TK_MAX: return GDScriptDecomp::GlobalToken::G_TK_MAX;
-# 	}
-# 	return GDScriptDecomp::GlobalToken::G_TK_MAX;
+# 	return global_tokens[p_token];
 # }
 # ```
 # 7) the `get_local_token_val` function, which is laid out like this:
 # ```cpp
 # int <class_name>::get_local_token_val(GDScriptDecomp::GlobalToken p_token) const {
-#   switch(p_token) {
-#     case GDScriptDecomp::GlobalToken::G_TK_EOF: return (int) TK_EOF;
-#     case GDScriptDecomp::GlobalToken::G_TK_IDENTIFIER: return (int) TK_IDENTIFIER;
-#     case GDScriptDecomp::GlobalToken::G_TK_CONSTANT: return (int) TK_CONSTANT;
-#     [..etc]
-#     case GDScriptDecomp::GlobalToken::G_TK_MAX: return (int) TK_MAX;
-#     default: return (int) TK_MAX;
-#   }
-#   return (int) TK_MAX;
+# 	if (p_token < 0 || p_token > GDScriptDecomp::GlobalToken::G_TK_MAX) {
+# 		return -1;
+# 	}
+# 	return local_tokens.values[p_token];
 # }
 # ```
 # That's it. We're done.
@@ -261,6 +265,60 @@ int {0}::get_function_index(const String &p_func) const {{
 """
 
 
+def hash_function_name(name: str, seed: int) -> int:
+    # Must match GDScriptDecomp::hash_function_name
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in name:
+        h ^= ord(c)
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def next_power_of_2(n: int) -> int:
+    p = 1
+    while p < n:
+        p <<= 1
+    return p
+
+
+def generate_function_hash_tables(func_names: list[str]) -> tuple[list[int], list[int]]:
+    # "Hash and displace" perfect hashing: names are first sorted into buckets by hash_function_name(name, 0),
+    # then every bucket (largest first) gets a seed that puts all of its names into free slots.
+    # Returns (displacements, slots), where slots hold indices into funcs[] (-1 if empty).
+    names = {}
+    for i, name in enumerate(func_names):
+        if name not in names:  # get_function_index has always returned the first match
+            names[name] = i
+    slot_count = next_power_of_2(len(names))
+    bucket_count = next_power_of_2(max(1, slot_count // 2))
+    buckets: list[list[str]] = [[] for _ in range(bucket_count)]
+    for name in names:
+        buckets[hash_function_name(name, 0) & (bucket_count - 1)].append(name)
+    displacements = [0] * bucket_count
+    slots = [-1] * slot_count
+    for bucket_idx in sorted(range(bucket_count), key=lambda b: len(buckets[b]), reverse=True):
+        bucket = buckets[bucket_idx]
+        if len(bucket) == 0:
+            break
+        displacement = 1
+        while True:
+            bucket_slots = [hash_function_name(name, displacement) & (slot_count - 1) for name in bucket]
+            if len(set(bucket_slots)) == len(bucket_slots) and all(slots[slot] == -1 for slot in bucket_slots):
+                break
+            displacement += 1
+        displacements[bucket_idx] = displacement
+        for name, slot in zip(bucket, bucket_slots):
+            slots[slot] = names[name]
+    return displacements, slots
+
+
+def write_int_array(f, decl: str, values: list[int], per_line: int = 16) -> None:
+    f.write(decl + " = {\n")
+    for i in range(0, len(values), per_line):
+        f.write("\t" + ", ".join(str(v) for v in values[i : i + per_line]) + ",\n")
+    f.write("};\n")
+
+
 def generate_class_cpp(dir: Path, bytecode_class: BytecodeClass) -> None:
     file_stem = bytecode_class.file_stem
     class_name = bytecode_class.class_name
@@ -348,39 +406,53 @@ def generate_class_cpp(dir: Path, bytecode_class: BytecodeClass) -> None:
 
             f.write("\n")
             # 5.5) the `get_function_index` function:
+            displacements, slots = generate_function_hash_tables(func_names)
+            write_int_array(f, "static constexpr uint32_t func_hash_displacements[]", displacements)
+            write_int_array(f, "static constexpr int16_t func_hash_slots[]", slots)
+            f.write("\n")
             f.write("int " + class_name + "::get_function_index(const String &p_func) const {\n")
-            f.write("\tfor (int i = 0; i < num_funcs; i++) {\n")
-            f.write("\t\tif (funcs[i].first == p_func) {\n")
-            f.write("\t\t\treturn i;\n")
-            f.write("\t\t}\n")
+            f.write(
+                "\tuint32_t displacement = func_hash_displacements[hash_function_name(p_func, 0) & "
+                + str(len(displacements) - 1)
+                + "];\n"
+            )
+            f.write(
+                "\tint idx = func_hash_slots[hash_function_name(p_func, displacement) & " + str(len(slots) - 1) + "];\n"
+            )
+            f.write("\tif (idx < 0 || funcs[idx].first != p_func) {\n")
+            f.write("\t\treturn -1;\n")
             f.write("\t}\n")
-            f.write("\treturn -1;\n")
+            f.write("\treturn idx;\n")
             f.write("}\n")
             f.write("\n")
 
-        # 6) the `get_global_token` function:
+        # 6) the token translation tables and the `get_global_token` function:
+        f.write("static constexpr GDScriptDecomp::GlobalToken global_tokens[] = {\n")
+        for tk_name in tk_names:
+            f.write("\tGDScriptDecomp::G_" + tk_name + ",\n")
+        f.write("};\n")
+        f.write("static_assert(sizeof(global_tokens) / sizeof(global_tokens[0]) == TK_MAX + 1);\n")
+        f.write("static constexpr GDScriptDecomp::LocalTokenTable local_tokens(global_tokens);\n")
+        f.write("\n")
+        f.write("const GDScriptDecomp::GlobalToken *" + class_name + "::get_global_token_table() const {\n")
+        f.write("\treturn global_tokens;\n")
+        f.write("}\n")
+        f.write("\n")
         f.write("GDScriptDecomp::GlobalToken " + class_name + "::get_global_token(int p_token) const {\n")
         f.write("\tp_token = p_token & TOKEN_MASK;\n")
         f.write("\tif (p_token < 0 || p_token >= TK_MAX) {\n")
         f.write("\t\treturn GDScriptDecomp::GlobalToken::G_TK_MAX;\n")
         f.write("\t}\n")
-        f.write("\tswitch(Token(p_token)) {\n")
-        for tk_name in tk_names:
-            f.write("\t\tcase " + tk_name + ": return GDScriptDecomp::GlobalToken::G_" + tk_name + ";\n")
-        f.write("\t\tdefault: return GDScriptDecomp::GlobalToken::G_TK_MAX;\n")
-        f.write("\t}\n")
-        f.write("\treturn GDScriptDecomp::GlobalToken::G_TK_MAX;\n")
+        f.write("\treturn global_tokens[p_token];\n")
         f.write("}\n")
         f.write("\n")
 
         # 7) the `get_local_token_val` function:
         f.write("int " + class_name + "::get_local_token_val(GDScriptDecomp::GlobalToken p_token) const {\n")
-        f.write("\tswitch(p_token) {\n")
-        for tk_name in tk_names:
-            f.write("\t\tcase GDScriptDecomp::GlobalToken::G_" + tk_name + ": return (int) " + tk_name + ";\n")
-        f.write("\t\tdefault: return -1;\n")
+        f.write("\tif (p_token < 0 || p_token > GDScriptDecomp::GlobalToken::G_TK_MAX) {\n")
+        f.write("\t\treturn -1;\n")
         f.write("\t}\n")
-        f.write("\treturn -1;\n")
+        f.write("\treturn local_tokens.values[p_token];\n")
         f.write("}\n")
         f.write("\n")
 
@@ -419,6 +491,7 @@ def generate_class_cpp(dir: Path, bytecode_class: BytecodeClass) -> None:
 # 	virtual Pair<int, int> get_function_arg_count(int p_func) const override;
 #   virtual int get_function_index(const String &p_func) const override;
 # 	virtual GDScriptDecomp::GlobalToken get_global_token(int p_token) const override;
+# 	virtual const GDScriptDecomp::GlobalToken *get_global_token_table() const override;
 # 	virtual int get_local_token_val(GDScriptDecomp::GlobalToken p_token) const override;
 # 	virtual BYTECODE_TEST_RESULT test_bytecode(Vector<uint8_t> buffer) override;
 # 	virtual int get_bytecode_version() const override { return bytecode_version; }
@@ -510,6 +583,7 @@ def generate_class_header(dir: Path, bytecode_class: BytecodeClass) -> None:
         f.write("\tvirtual int get_token_max() const override;\n")
         f.write("\tvirtual int get_function_index(const String &p_func) const override;\n")
         f.write("\tvirtual GDScriptDecomp::GlobalToken get_global_token(int p_token) const override;\n")
+        f.write("\tvirtual const GDScriptDecomp::GlobalToken *get_global_token_table() const override;\n")
         f.write("\tvirtual int get_local_token_val(GDScriptDecomp::GlobalToken p_token) const override;\n")
         f.write("\tvirtual int get_bytecode_version() const override { return bytecode_version; }\n")
         f.write("\tvirtual int get_bytecode_rev() const override { return bytecode_rev; }\n")
@@ -652,12 +726,12 @@ def generate_bytecode_description_string(bytecode_class: BytecodeClass) -> str:
 #
 # struct GDScriptDecompVersion {
 # 	uint64_t commit;
-# 	String name;
+# 	const char *name;
 #   int bytecode_version;
 #   bool is_dev;
 # };
 #
-# static const GDScriptDecompVersion decomp_versions[] = {
+# inline constexpr GDScriptDecompVersion decomp_versions[] = {
 # // This contains a list of all the bytecode versions, in order, with their version, commit hash, date, and bytecode version, followed by a description derived from the "added_tokens", "added_functions", etc. fields>
 # // for example:
 # { 0xf3f05dc, "     4.0 dev (f3f05dc / 2020-02-13 / Bytecode version: 13) - removed `SYNC` and `SLAVE` tokens", 13, true }, // If it's a dev version, there's 5 leading spaces in the description, otherwise it's 0
@@ -666,7 +740,6 @@ def generate_bytecode_description_string(bytecode_class: BytecodeClass) -> str:
 # };
 
 BYTECODE_CLASSDB_REGISTER = "//_BYTECODE_CLASSDB_REGISTER_"
-BYTECODE_CASE_STATEMENTS = "//_BYTECODE_CASE_STATEMENTS_"
 BYTECODE_HEADERS = "//_BYTECODE_HEADERS_"
 BYTECODE_DECOMP_VERSIONS = "//_BYTECODE_DECOMP_VERSIONS_"
 PRELUDE_REPLACE = "//_PRELUDE_"
@@ -690,7 +763,7 @@ def generate_bytecode_version_header(dir: Path, bytecode_classes: list[BytecodeC
     code = code.replace(BYTECODE_HEADERS, header_str)
     version_section = '\t{ 0xfffffff, "--- Please select bytecode version ---", 0, false },\n'
     # "4.3.0 release (77af6ca / 2024-02-09 / Bytecode version: 100) - initial version"
-    ver_format = '\t{{ 0x{commit}, "{name}", {bytecode_version}, {is_dev}, "{ver}", "{max_ver}", 0x{parent} }},\n'
+    ver_format = '\t{{ 0x{commit}, "{name}", {bytecode_version}, {is_dev}, "{ver}", "{max_ver}", 0x{parent}, {engine_ver_major}, {variant_ver_major}, {token_max}, {function_count}, &_create_decomp<{class_name}> }},\n'
     name_format = "{ver} ({commit} / {date} / Bytecode version: {bytecode_version}) - {description}"
     for bytecode_class in bytecode_classes:
         name_tab = "\t" if bytecode_class.is_dev else ""
@@ -711,6 +784,11 @@ def generate_bytecode_version_header(dir: Path, bytecode_classes: list[BytecodeC
             ver=bytecode_class.engine_version,
             max_ver=bytecode_class.max_engine_version if bytecode_class.max_engine_version else "",
             parent=bytecode_class.parent if bytecode_class.parent else 0,
+            engine_ver_major=bytecode_class.engine_ver_major,
+            variant_ver_major=bytecode_class.variant_ver_major,
+            token_max=bytecode_class.tk_names.index("TK_MAX"),
+            function_count=len(bytecode_class.func_names),
+            class_name=bytecode_class.class_name,
         )
         version_section += line
     version_section += '\t{ 0x0000000, "-NULL-", 0, false },\n'
@@ -735,12 +813,6 @@ def generate_bytecode_versions_cpp(dir: Path, bytecode_classes: list[BytecodeCla
     for bytecode_class in bytecode_classes:
         bytecode_classdb_register += "\tClassDB::register_class<" + bytecode_class.class_name + ">();\n"
     code = code.replace(BYTECODE_CLASSDB_REGISTER, bytecode_classdb_register)
-    bytecode_case_statements = ""
-    for bytecode_class in bytecode_classes:
-        bytecode_case_statements += (
-            "\t\tcase 0x" + bytecode_class.bytecode_rev + ": return memnew(" + bytecode_class.class_name + ");\n"
-        )
-    code = code.replace(BYTECODE_CASE_STATEMENTS, bytecode_case_statements)
 
     with open(new_file_cpp, "w") as f:
         f.write(code)
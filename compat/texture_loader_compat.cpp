@@ -32,6 +32,50 @@ bool is_real_or_gltf_load(ResourceInfo::LoadType p_type) {
 	return p_type == ResourceInfo::LoadType::REAL_LOAD || p_type == ResourceInfo::LoadType::GLTF_LOAD;
 }
 
+// Only distinguishes the standalone 2D texture formats, which can be told apart without parsing the resource
+TextureLoaderCompat::TextureVersionType get_texture2d_type_from_header(const Ref<FileAccess> &f) {
+	uint8_t header[4];
+	f->get_buffer(header, 4);
+	if (header[0] == 'G' && header[1] == 'D' && header[2] == 'S' && header[3] == 'T') {
+		return TextureLoaderCompat::FORMAT_V3_STREAM_TEXTURE2D;
+	} else if (header[0] == 'G' && header[1] == 'S' && header[2] == 'T' && header[3] == '2') {
+		return TextureLoaderCompat::FORMAT_V4_COMPRESSED_TEXTURE2D;
+	}
+	return TextureLoaderCompat::FORMAT_NOT_TEXTURE;
+}
+
+// Same as CompressedTexture2D::load_image_from_file, but only reads the base level
+Ref<Image> load_base_level_from_file_v4(const Ref<FileAccess> &f) {
+	uint64_t data_start = f->get_position();
+	uint32_t data_format = f->get_32();
+	uint32_t w = f->get_16();
+	uint32_t h = f->get_16();
+	f->get_32(); // mipmap count
+	Image::Format format = Image::Format(f->get_32());
+
+	if (data_format == CompressedTexture2D::DATA_FORMAT_PNG || data_format == CompressedTexture2D::DATA_FORMAT_WEBP) {
+		uint32_t size = f->get_32();
+		ERR_FAIL_COND_V_MSG(size == 0 || f->get_position() + size > f->get_length(), Ref<Image>(), "Embedded image data is corrupt");
+		Vector<uint8_t> pv;
+		pv.resize(size);
+		f->get_buffer(pv.ptrw(), size);
+		if (data_format == CompressedTexture2D::DATA_FORMAT_PNG) {
+			return Image::png_unpacker(pv);
+		}
+		return Image::webp_unpacker(pv);
+	} else if (data_format == CompressedTexture2D::DATA_FORMAT_IMAGE) {
+		ERR_FAIL_INDEX_V(format, Image::FORMAT_MAX, Ref<Image>());
+		int64_t size = Image::get_image_data_size(w, h, format, false);
+		Vector<uint8_t> data;
+		data.resize(size);
+		ERR_FAIL_COND_V(f->get_buffer(data.ptrw(), size) != (uint64_t)size, Ref<Image>());
+		return Image::create_from_data(w, h, false, format, data);
+	}
+	// basis universal keeps every level in a single blob that has to be transcoded as a whole
+	f->seek(data_start);
+	return CompressedTexture2D::load_image_from_file(f, 0);
+}
+
 void set_res_path(Ref<Resource> res, const String &path, ResourceInfo::LoadType p_type) {
 	// TODO: disable this for now; if we're doing a fake or non-global load, we don't want to set the path, and we manually set the path wherever we're using real/gltf load.
 	// if (res.is_valid()) {
@@ -224,7 +268,7 @@ String TextureLoaderCompat::get_type_name_from_textype(TextureVersionType type)
 	}
 }
 
-Error TextureLoaderCompat::load_image_from_fileV3(Ref<FileAccess> f, int tw, int th, int tw_custom, int th_custom, int flags, int p_size_limit, uint32_t df, Ref<Image> &image) {
+Error TextureLoaderCompat::load_image_from_fileV3(Ref<FileAccess> f, int tw, int th, int tw_custom, int th_custom, int flags, int p_size_limit, uint32_t df, Ref<Image> &image, bool p_base_level_only) {
 	Image::Format format;
 	if (!(df & FORMAT_BIT_STREAM)) {
 		// do something??
@@ -249,6 +293,9 @@ Error TextureLoaderCompat::load_image_from_fileV3(Ref<FileAccess> f, int tw, int
 			sh = MAX(sh >> 1, 1);
 			mipmaps--;
 		}
+		if (p_base_level_only) {
+			mipmaps = 1;
+		}
 
 		// mipmaps need to be read independently, they will be later combined
 		Vector<Ref<Image>> mipmap_images;
@@ -317,7 +364,8 @@ Error TextureLoaderCompat::load_image_from_fileV3(Ref<FileAccess> f, int tw, int
 			ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Texture is in an invalid format: " + itos(v3_fmt));
 		}
 
-		bool mipmaps = df & FORMAT_BIT_HAS_MIPMAPS;
+		// the base level comes first, so it can be read on its own
+		bool mipmaps = (df & FORMAT_BIT_HAS_MIPMAPS) && !p_base_level_only;
 
 		if (!mipmaps) {
 			int size = Image::get_image_data_size(tw, th, format, false);
@@ -399,7 +447,7 @@ public:
 };
 static_assert(sizeof(faketex2D) == sizeof(CompressedTexture2D), "faketex2D must be the same size as CompressedTexture2D");
 
-Error TextureLoaderCompat::_load_data_stex2d_v3(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, int &flags, Ref<Image> &image, int p_size_limit) {
+Error TextureLoaderCompat::_load_data_stex2d_v3(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, int &flags, Ref<Image> &image, int p_size_limit, bool p_base_level_only) {
 	Error err;
 
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
@@ -419,7 +467,7 @@ Error TextureLoaderCompat::_load_data_stex2d_v3(const String &p_path, int &tw, i
 	if (image.is_null()) {
 		image.instantiate();
 	}
-	err = load_image_from_fileV3(f, tw, th, tw_custom, th_custom, flags, p_size_limit, df, image);
+	err = load_image_from_fileV3(f, tw, th, tw_custom, th_custom, flags, p_size_limit, df, image, p_base_level_only);
 	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to load image from texture file " + p_path);
 
 	/*
@@ -432,7 +480,7 @@ Error TextureLoaderCompat::_load_data_stex2d_v3(const String &p_path, int &tw, i
 	return OK;
 }
 
-Error TextureLoaderCompat::_load_data_ctex2d_v4(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, Ref<Image> &image, int p_size_limit) {
+Error TextureLoaderCompat::_load_data_ctex2d_v4(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, Ref<Image> &image, int p_size_limit, bool p_base_level_only) {
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	uint8_t header[4];
 	// already checked header
@@ -457,7 +505,11 @@ Error TextureLoaderCompat::_load_data_ctex2d_v4(const String &p_path, int &tw, i
 	if (!(df & FORMAT_BIT_STREAM)) {
 		p_size_limit = 0;
 	}
-	image = CompressedTexture2D::load_image_from_file(f, p_size_limit);
+	if (p_base_level_only) {
+		image = load_base_level_from_file_v4(f);
+	} else {
+		image = CompressedTexture2D::load_image_from_file(f, p_size_limit);
+	}
 
 	if (image.is_null() || image->is_empty()) {
 		return ERR_CANT_OPEN;
@@ -471,6 +523,79 @@ Error TextureLoaderCompat::_load_data_ctex2d_v4(const String &p_path, int &tw, i
 	return OK;
 }
 
+Error TextureLoaderCompat::get_embedded_png(const String &p_path, Vector<uint8_t> &r_data) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, "Can't open texture file " + p_path);
+	TextureVersionType t = get_texture2d_type_from_header(f);
+	if (t == FORMAT_V3_STREAM_TEXTURE2D) {
+		// width, width_custom, height, height_custom, flags
+		f->seek(16);
+		uint32_t df = f->get_32();
+		if (!(df & FORMAT_BIT_PNG)) {
+			return ERR_UNAVAILABLE;
+		}
+		f->get_32(); // mipmap count
+	} else if (t == FORMAT_V4_COMPRESSED_TEXTURE2D) {
+		uint32_t version = f->get_32();
+		ERR_FAIL_COND_V_MSG(version > CompressedTexture2D::FORMAT_VERSION, ERR_FILE_CORRUPT, "Compressed texture file is too new.");
+		// width_custom, height_custom, data format, reserved
+		f->seek(36);
+		uint32_t data_format = f->get_32();
+		if (data_format != CompressedTexture2D::DATA_FORMAT_PNG) {
+			return ERR_UNAVAILABLE;
+		}
+		// width, height, mipmap count, image format
+		f->seek(f->get_position() + 12);
+	} else {
+		return ERR_UNAVAILABLE;
+	}
+	// mip-0 comes first; the lossless packer prefixes the PNG with a "PNG " tag (see Image::png_unpacker)
+	uint32_t size = f->get_32();
+	ERR_FAIL_COND_V_MSG(size <= 4 || f->get_position() + size > f->get_length(), ERR_FILE_CORRUPT, "Embedded image data is corrupt in " + p_path);
+	uint8_t tag[4];
+	f->get_buffer(tag, 4);
+	if (tag[0] != 'P' || tag[1] != 'N' || tag[2] != 'G' || tag[3] != ' ') {
+		return ERR_UNAVAILABLE;
+	}
+	size -= 4;
+	r_data.resize(size);
+	f->get_buffer(r_data.ptrw(), size);
+
+	static const uint8_t png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	if (size < 8 || memcmp(r_data.ptr(), png_signature, 8) != 0) {
+		r_data.clear();
+		return ERR_UNAVAILABLE;
+	}
+	return OK;
+}
+
+Ref<Image> TextureLoaderCompat::load_image_base_level(const String &p_path, Error *r_err) {
+	Error err;
+	if (!r_err) {
+		r_err = &err;
+	}
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, r_err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), Ref<Image>(), "Can't open texture file " + p_path);
+	TextureVersionType t = get_texture2d_type_from_header(f);
+	f = Ref<FileAccess>();
+
+	int tw, th, tw_custom, th_custom, flags;
+	Ref<Image> image;
+	if (t == FORMAT_V3_STREAM_TEXTURE2D) {
+		*r_err = _load_data_stex2d_v3(p_path, tw, th, tw_custom, th_custom, flags, image, 0, true);
+	} else if (t == FORMAT_V4_COMPRESSED_TEXTURE2D) {
+		*r_err = _load_data_ctex2d_v4(p_path, tw, th, tw_custom, th_custom, image, 0, true);
+	} else {
+		*r_err = ERR_FILE_UNRECOGNIZED;
+		return Ref<Image>();
+	}
+	if (*r_err != OK) {
+		return Ref<Image>();
+	}
+	return image;
+}
+
 Error TextureLoaderCompat::_load_layered_texture_v3(const String &p_path, Vector<Ref<Image>> &r_data, Image::Format &r_format, int &r_width, int &r_height, int &r_depth, bool &r_mipmaps) {
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
@@ -41,9 +41,14 @@ public:
 	static Error _load_layered_texture_v3(const String &p_path, Vector<Ref<Image>> &r_data, Image::Format &r_format, int &r_width, int &r_height, int &r_depth, bool &r_mipmaps);
 	static ResourceInfo _get_resource_info(TextureLoaderCompat::TextureVersionType t);
 	static ResourceInfo get_resource_info(const String &p_path, Error *r_error);
-	static Error load_image_from_fileV3(Ref<FileAccess> f, int tw, int th, int tw_custom, int th_custom, int flags, int p_size_limit, uint32_t df, Ref<Image> &image);
-	static Error _load_data_ctex2d_v4(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, Ref<Image> &image, int p_size_limit = 0);
-	static Error _load_data_stex2d_v3(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, int &flags, Ref<Image> &image, int p_size_limit = 0);
+	// p_base_level_only skips the mipmap chain, for callers that only need the full-size image (e.g. exporting)
+	static Error load_image_from_fileV3(Ref<FileAccess> f, int tw, int th, int tw_custom, int th_custom, int flags, int p_size_limit, uint32_t df, Ref<Image> &image, bool p_base_level_only = false);
+	static Error _load_data_ctex2d_v4(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, Ref<Image> &image, int p_size_limit = 0, bool p_base_level_only = false);
+	static Error _load_data_stex2d_v3(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, int &flags, Ref<Image> &image, int p_size_limit = 0, bool p_base_level_only = false);
+	// Loads only the base level of a v3 .stex or v4 .ctex; ERR_FILE_UNRECOGNIZED for any other kind of texture.
+	static Ref<Image> load_image_base_level(const String &p_path, Error *r_err);
+	// Reads the mip-0 PNG embedded in a lossless v3 .stex or v4 .ctex without decoding it; ERR_UNAVAILABLE if there isn't one.
+	static Error get_embedded_png(const String &p_path, Vector<uint8_t> &r_data);
 
 	static Ref<ImageTexture> create_image_texture(const String &p_path, ResourceInfo::LoadType p_type, int tw, int th, int tw_custom, int th_custom, bool mipmaps, Ref<Image> image);
 	static bool is_binary_resource(TextureVersionType t);
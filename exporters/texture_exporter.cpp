@@ -12,12 +12,29 @@
 #include "scene/resources/atlas_texture.h"
 
 namespace {
-bool get_bit(const Vector<uint8_t> &bitmask, int width, int p_x, int p_y) {
-	int ofs = width * p_y + p_x;
-	int bbyte = ofs / 8;
-	int bbit = ofs % 8;
+// Each byte of a bitmask expanded to 8 L8 pixels, least significant bit first
+struct BitExpandTable {
+	uint8_t entries[256][8];
+	constexpr BitExpandTable() :
+			entries() {
+		for (int i = 0; i < 256; i++) {
+			for (int b = 0; b < 8; b++) {
+				entries[i][b] = (i & (1 << b)) ? 0xFF : 0;
+			}
+		}
+	}
+};
+constexpr BitExpandTable bit_expand_table;
 
-	return (bitmask[bbyte] & (1 << bbit)) != 0;
+// Bits are packed row-major, so the bit index is the same as the pixel index
+void unpack_bits_to_l8(const uint8_t *p_bits, int64_t p_bit_count, uint8_t *r_pixels) {
+	int64_t full_bytes = p_bit_count / 8;
+	for (int64_t i = 0; i < full_bytes; i++) {
+		memcpy(r_pixels + i * 8, bit_expand_table.entries[p_bits[i]], 8);
+	}
+	for (int64_t i = full_bytes * 8; i < p_bit_count; i++) {
+		r_pixels[i] = (p_bits[i / 8] & (1 << (i % 8))) ? 0xFF : 0;
+	}
 }
 } //namespace
 
@@ -28,6 +45,9 @@ Ref<Image> TextureExporter::load_image_from_bitmap(const String p_path, Error *r
 	image.instantiate();
 	ResourceFormatLoaderCompatBinary rlcb;
 	auto res = ResourceCompatLoader::fake_load(p_path, "", &err);
+	if (r_err) {
+		*r_err = err;
+	}
 	ERR_FAIL_COND_V_MSG(err != OK, Ref<Image>(), "Cannot open resource '" + p_path + "'.");
 
 	String name;
@@ -44,17 +64,37 @@ Ref<Image> TextureExporter::load_image_from_bitmap(const String p_path, Error *r
 	size = data.get("size", Vector2());
 	width = size.width;
 	height = size.height;
-	image->initialize_data(width, height, false, Image::FORMAT_L8);
+	if (width <= 0 || height <= 0) {
+		if (r_err) {
+			*r_err = ERR_FILE_CORRUPT;
+		}
+		ERR_FAIL_V_MSG(Ref<Image>(), "Invalid bitmap size in " + p_path);
+	}
+	int64_t pixel_count = (int64_t)width * height;
+	if (bitmask.size() < (pixel_count + 7) / 8) {
+		if (r_err) {
+			*r_err = ERR_FILE_CORRUPT;
+		}
+		ERR_FAIL_V_MSG(Ref<Image>(), "Bitmap data is too short in " + p_path);
+	}
+
+	Vector<uint8_t> pixels;
+	pixels.resize(pixel_count);
+	unpack_bits_to_l8(bitmask.ptr(), pixel_count, pixels.ptrw());
+	image->initialize_data(width, height, false, Image::FORMAT_L8, pixels);
 
 	if (!name.is_empty()) {
 		image->set_name(name);
 	}
-	for (int i = 0; i < width; i++) {
-		for (int j = 0; j < height; j++) {
-			image->set_pixel(i, j, get_bit(bitmask, width, i, j) ? Color(1, 1, 1) : Color(0, 0, 0));
+	if (image.is_null() || image->is_empty()) {
+		if (r_err) {
+			*r_err = ERR_FILE_CORRUPT;
 		}
+		ERR_FAIL_V_MSG(Ref<Image>(), "Failed to load image from " + p_path);
+	}
+	if (r_err) {
+		*r_err = OK;
 	}
-	ERR_FAIL_COND_V_MSG(image.is_null() || image->is_empty(), Ref<Image>(), "Failed to load image from " + p_path);
 	return image;
 }
 
@@ -106,8 +146,28 @@ Error TextureExporter::save_image(const String &dest_path, const Ref<Image> &img
 Error TextureExporter::_convert_tex(const String &p_path, const String &dest_path, bool lossy, String &image_format) {
 	Error err;
 	String dst_dir = dest_path.get_base_dir();
-	Ref<Texture2D> tex;
-	tex = ResourceCompatLoader::non_global_load(p_path, "", &err);
+	if (dest_path.get_extension().to_lower() == "png") {
+		// Lossless textures usually embed the imported PNG as-is; copy it out instead of decoding and re-encoding it
+		Vector<uint8_t> png_data;
+		if (TextureLoaderCompat::get_embedded_png(p_path, png_data) == OK) {
+			err = gdre::ensure_dir(dst_dir);
+			ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to create dirs for " + dest_path);
+			Ref<FileAccess> f = FileAccess::open(dest_path, FileAccess::WRITE, &err);
+			ERR_FAIL_COND_V_MSG(f.is_null(), err, "Failed to open " + dest_path + " for writing");
+			ERR_FAIL_COND_V_MSG(!f->store_buffer(png_data.ptr(), png_data.size()), ERR_FILE_CANT_WRITE, "Failed to write " + dest_path);
+			image_format = "PNG";
+			print_verbose("Copied embedded PNG from " + p_path + " to " + dest_path);
+			return OK;
+		}
+	}
+	// Only the base level gets saved, so don't bother decoding the mipmaps
+	Ref<Image> img = TextureLoaderCompat::load_image_base_level(p_path, &err);
+	if (err == ERR_FILE_UNRECOGNIZED) {
+		Ref<Texture2D> tex = ResourceCompatLoader::non_global_load(p_path, "", &err);
+		if (tex.is_valid()) {
+			img = tex->get_image();
+		}
+	}
 	// deprecated format
 	if (err == ERR_UNAVAILABLE) {
 		// TODO: Not reporting here because we can't get the deprecated format type yet,
@@ -116,9 +176,7 @@ Error TextureExporter::_convert_tex(const String &p_path, const String &dest_pat
 		print_line("Did not convert deprecated Texture resource " + p_path);
 		return err;
 	}
-	ERR_FAIL_COND_V_MSG(err != OK || tex.is_null(), err, "Failed to load texture " + p_path);
-
-	Ref<Image> img = tex->get_image();
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to load texture " + p_path);
 
 	ERR_FAIL_COND_V_MSG(img.is_null(), ERR_PARSE_ERROR, "Failed to load image for texture " + p_path);
 	ERR_FAIL_COND_V_MSG(img->is_empty(), ERR_FILE_EOF, "Image data is empty for texture " + p_path + ", not saving");
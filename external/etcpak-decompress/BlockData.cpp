@@ -976,14 +976,29 @@ static etcpak_force_inline void DecodeRGSignedPart( uint64_t r, uint64_t g, uint
     }
 }
 
+int etcpak_decompress::get_block_size(EtcFormat format) {
+	switch (format) {
+		case EtcFormat::Etc2_RGBA:
+		case EtcFormat::Etc2_RG11:
+		case EtcFormat::Etc2_RG11S:
+			return 16;
+		default:
+			return 8;
+	}
+}
+
 void etcpak_decompress::decompress_image(EtcFormat format, const void *dsrc, void *ddst, const uint64_t width, const uint64_t height, const int64_t total_size) {
-	const uint64_t *src = (const uint64_t *)(dsrc);
-	uint32_t *dst = (uint32_t *)ddst;
+	decompress_block_rows(format, dsrc, ddst, width, 0, height / 4);
+}
+
+void etcpak_decompress::decompress_block_rows(EtcFormat format, const void *dsrc, void *ddst, const uint64_t width, const uint64_t row_start, const uint64_t row_end) {
+	const uint64_t *src = (const uint64_t *)(dsrc) + row_start * (width / 4) * (get_block_size(format) / 8);
+	uint32_t *dst = (uint32_t *)ddst + row_start * 4 * width;
 
 	switch (format) {
 		case EtcFormat::Etc1:
 		case EtcFormat::Etc2_RGB: {
-			for (int y = 0; y < height / 4; y++) {
+			for (uint64_t y = row_start; y < row_end; y++) {
 				for (int x = 0; x < width / 4; x++) {
 					uint64_t d = *src++;
 					DecodeRGBPart(d, dst, width);
@@ -993,7 +1008,7 @@ void etcpak_decompress::decompress_image(EtcFormat format, const void *dsrc, voi
 			}
 		} break;
         case EtcFormat::Etc2_RGBA1: {
-			for (int y = 0; y < height / 4; y++) {
+			for (uint64_t y = row_start; y < row_end; y++) {
 				for (int x = 0; x < width / 4; x++) {
 					uint64_t d = *src++;
 					DecodeRGBA1Part(d, dst, width);
@@ -1003,7 +1018,7 @@ void etcpak_decompress::decompress_image(EtcFormat format, const void *dsrc, voi
 			}
 		} break;
 		case EtcFormat::Etc2_RGBA: {
-			for (int y = 0; y < height / 4; y++) {
+			for (uint64_t y = row_start; y < row_end; y++) {
 				for (int x = 0; x < width / 4; x++) {
 					uint64_t a = *src++;
 					uint64_t d = *src++;
@@ -1015,7 +1030,7 @@ void etcpak_decompress::decompress_image(EtcFormat format, const void *dsrc, voi
 
 		} break;
 		case EtcFormat::Etc2_R11: {
-			for (int y = 0; y < height / 4; y++) {
+			for (uint64_t y = row_start; y < row_end; y++) {
 				for (int x = 0; x < width / 4; x++) {
 					uint64_t r = *src++;
 					DecodeRPart(r, dst, width);
@@ -1025,7 +1040,7 @@ void etcpak_decompress::decompress_image(EtcFormat format, const void *dsrc, voi
 			}
 		} break;
         case EtcFormat::Etc2_R11S: {
-			for (int y = 0; y < height / 4; y++) {
+			for (uint64_t y = row_start; y < row_end; y++) {
 				for (int x = 0; x < width / 4; x++) {
 					uint64_t r = *src++;
 					DecodeRSignedPart(r, dst, width);
@@ -1036,7 +1051,7 @@ void etcpak_decompress::decompress_image(EtcFormat format, const void *dsrc, voi
 		} break;
 
 		case EtcFormat::Etc2_RG11: {
-			for (int y = 0; y < height / 4; y++) {
+			for (uint64_t y = row_start; y < row_end; y++) {
 				for (int x = 0; x < width / 4; x++) {
 					uint64_t r = *src++;
 					uint64_t g = *src++;
@@ -1047,7 +1062,7 @@ void etcpak_decompress::decompress_image(EtcFormat format, const void *dsrc, voi
 			}
 		} break;
         case EtcFormat::Etc2_RG11S: {
-			for (int y = 0; y < height / 4; y++) {
+			for (uint64_t y = row_start; y < row_end; y++) {
 				for (int x = 0; x < width / 4; x++) {
 					uint64_t r = *src++;
 					uint64_t g = *src++;
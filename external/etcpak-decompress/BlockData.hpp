@@ -80,4 +80,9 @@
 #include "etc_format.h"
 namespace etcpak_decompress{
 void decompress_image(EtcFormat format, const void *dsrc, void *ddst, const uint64_t width, const uint64_t height, const int64_t total_size);
+// Bytes per 4x4 block.
+int get_block_size(EtcFormat format);
+// Decompresses the block rows [row_start, row_end); dsrc and ddst point to the start of the whole image.
+// Block rows don't overlap in either buffer, so ranges can be decompressed concurrently.
+void decompress_block_rows(EtcFormat format, const void *dsrc, void *ddst, const uint64_t width, const uint64_t row_start, const uint64_t row_end);
 }; // namespace etcpak_decompress
\ No newline at end of file
@@ -32,9 +32,46 @@
 
 #include "external/etcpak-decompress/BlockData.hpp"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
+namespace {
+// Block rows per worker task; levels smaller than two chunks are decompressed on the calling thread.
+constexpr uint64_t BLOCK_ROWS_PER_TASK = 16;
+
+struct EtcDecompressTask {
+	EtcFormat format = EtcFormat::Etc1;
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	uint64_t width = 0;
+	uint64_t block_rows = 0;
+};
+
+void decompress_rows(void *p_userdata, uint32_t p_index) {
+	const EtcDecompressTask *task = (const EtcDecompressTask *)p_userdata;
+	uint64_t row_start = p_index * BLOCK_ROWS_PER_TASK;
+	uint64_t row_end = MIN(row_start + BLOCK_ROWS_PER_TASK, task->block_rows);
+	etcpak_decompress::decompress_block_rows(task->format, task->src, task->dst, task->width, row_start, row_end);
+}
+
+void decompress_level(EtcFormat p_format, const uint8_t *p_src, uint8_t *p_dst, int p_width, int p_height) {
+	EtcDecompressTask task;
+	task.format = p_format;
+	task.src = p_src;
+	task.dst = p_dst;
+	task.width = p_width;
+	task.block_rows = p_height / 4;
+	if (task.block_rows < BLOCK_ROWS_PER_TASK * 2) {
+		etcpak_decompress::decompress_block_rows(p_format, p_src, p_dst, task.width, 0, task.block_rows);
+		return;
+	}
+	int task_count = (task.block_rows + BLOCK_ROWS_PER_TASK - 1) / BLOCK_ROWS_PER_TASK;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&decompress_rows, &task, task_count, -1, true, SNAME("image_decompress_etc"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+} //namespace
+
 void image_decompress_etc(Image *p_image) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -116,7 +153,7 @@ void image_decompress_etc(Image *p_image) {
 		int mipmap_w = 0, mipmap_h = 0;
 		int64_t src_ofs = Image::get_image_mipmap_offset_and_dimensions(width, height, source_format, i, mipmap_w, mipmap_h);
 		int64_t dst_ofs = Image::get_image_mipmap_offset(width, height, start_format, i);
-		etcpak_decompress::decompress_image(bcdec_format, rb + src_ofs, wb + dst_ofs, mipmap_w, mipmap_h, target_size);
+		decompress_level(bcdec_format, rb + src_ofs, wb + dst_ofs, mipmap_w, mipmap_h);
 		// if (total_dest_written != target_size) {
 		// 	ERR_FAIL_MSG("etcpak-decompress: Decompression failed.");
 		// }
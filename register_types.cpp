@@ -33,6 +33,7 @@
 #include "utility/godotver.h"
 #include "utility/import_exporter.h"
 #include "utility/packed_file_info.h"
+#include "utility/pck_creator.h"
 #include "utility/pck_dumper.h"
 
 #include "module_etc_decompress/register_types.h"
@@ -80,6 +81,7 @@ void free_ver_regex() {
 	GodotVer::non_strict_regex = Ref<RegEx>();
 	Glob::magic_check = Ref<RegEx>();
 	Glob::escapere = Ref<RegEx>();
+	Glob::clear_pattern_cache();
 }
 
 void init_loaders() {
@@ -219,6 +221,7 @@ void initialize_gdsdecomp_module(ModuleInitializationLevel p_level) {
 
 	ClassDB::register_class<GodotREEditorStandalone>();
 	ClassDB::register_class<PckDumper>();
+	ClassDB::register_class<PckCreator>();
 	ClassDB::register_class<ResourceImportMetadatav2>();
 	ClassDB::register_abstract_class<ImportInfo>();
 
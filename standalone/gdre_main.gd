@@ -244,12 +244,13 @@ func dump_files(output_dir:String, files: PackedStringArray, ignore_checksum_err
 	# print("Extraction complete in %02dm%02ds" % [(secs_taken) / 60, (secs_taken) % 60])
 	return err;
 
-var MAIN_COMMANDS = ["--recover", "--extract", "--compile", "--list-bytecode-versions"]
+var MAIN_COMMANDS = ["--recover", "--extract", "--compile", "--pck-create", "--list-bytecode-versions"]
 var MAIN_CMD_NOTES = """Main commands:
 --recover=<GAME_PCK/EXE/APK/DIR>   Perform full project recovery on the specified PCK, APK, EXE, or extracted project directory.
 --extract=<GAME_PCK/EXE/APK>       Extract the specified PCK, APK, or EXE.
 --compile=<GD_FILE>                Compile GDScript files to bytecode (can be repeated and use globs, requires --bytecode)
 --decompile=<GDC_FILE>             Decompile GDC files to text (can be repeated and use globs)
+--pck-create=<DIR>                 Create a PCK from the contents of the specified directory
 --list-bytecode-versions           List all available bytecode versions
 --txt-to-bin=<FILE>                Convert text-based scene or resource files to binary format (can be repeated)
 --bin-to-txt=<FILE>                Convert binary scene or resource files to text-based format (can be repeated)
@@ -281,6 +282,7 @@ var RECOVER_OPTS_NOTES = """Recover/Extract Options:
 --include=<GLOB>            Include files matching the glob pattern (can be repeated)
 --exclude=<GLOB>            Exclude files matching the glob pattern (can be repeated)
 --ignore-checksum-errors    Ignore MD5 checksum errors when extracting/recovering
+--use-pack-cache            Cache the detected engine version, bytecode revision and import info, so re-opening the same pack is faster
 """
 # todo: handle --key option
 var COMPILE_OPTS_NOTES = """Decompile/Compile Options:
@@ -290,6 +292,13 @@ var COMPILE_OPTS_NOTES = """Decompile/Compile Options:
 										  - If not specified, compiled files will be output to the same location 
 										  (e.g. '<PROJ_DIR>/main.gd' -> '<PROJ_DIR>/main.gdc')
 """
+var PCK_CREATE_OPTS_NOTES = """PCK Create Options:
+--pck-output=<FILE>                     The PCK file to create, defaults to <DIR>.pck
+--pck-engine-version=<VERSION>          Engine version to write in the header (e.g. '4.3.0'), defaults to '4.0.0'
+										  - Engine versions older than 4.0 get pack format version 1, which can't be encrypted
+--pck-encrypt=<GLOB>                    Encrypt files matching the glob pattern with --key (can be repeated)
+--pck-encrypt-dir                       Encrypt the pack directory with --key
+"""
 func print_usage():
 	print("Godot Reverse Engineering Tools")
 	print("")
@@ -302,6 +311,7 @@ func print_usage():
 	print(RECOVER_OPTS_NOTES)
 	print(GLOB_NOTES)
 	print(COMPILE_OPTS_NOTES)
+	print(PCK_CREATE_OPTS_NOTES)
 
 
 # TODO: remove this hack
@@ -547,23 +557,11 @@ func compile(files: PackedStringArray, bytecode_version: String, output_dir: Str
 		print("Error: no files found to compile")
 		return -1
 	ensure_dir_exists(output_dir)
-	for file in new_files:
-		print("Compiling " + file)
-		if file.get_extension() != "gd":
-			print("Error: " + file + " is not a GDScript file")
-			continue
-		var f = FileAccess.open(file, FileAccess.READ)
-		var code = f.get_as_text()
-		var bytecode: PackedByteArray = decomp.compile_code_string(code)
-		if bytecode.is_empty():
-			print("Error: failed to compile " + file)
-			print(decomp.get_error_message())
-			continue
-		var out_file = output_dir.path_join(file.get_file().replace(".gd", ".gdc"))
-		var out_f = FileAccess.open(out_file, FileAccess.WRITE)
-		out_f.store_buffer(bytecode)
-		out_f.close()
-		print("Compiled " + file + " to " + out_file)		
+	print("Compiling %d files to %s" % [new_files.size(), output_dir])
+	var errors: PackedStringArray = decomp.compile_files(new_files, output_dir)
+	for error in errors:
+		print("Error: failed to compile " + error)
+	print("Compiled %d of %d files" % [new_files.size() - errors.size(), new_files.size()])
 	print("Compilation complete")
 	return 0
 
@@ -640,6 +638,38 @@ func bin_to_text(files: PackedStringArray, output_dir: String):
 		var dst_file = file.get_file().replace(".scn", ".tscn").replace(".res", ".tres")
 		importer.convert_res_bin_2_txt(output_dir, file, dst_file)
 
+func pck_create(dir: String, output: String, engine_version: String, encrypt_globs: PackedStringArray, encrypt_dir: bool, key: String = "") -> int:
+	dir = get_cli_abs_path(dir)
+	if not DirAccess.dir_exists_absolute(dir):
+		print("Error: " + dir + " is not a directory")
+		return -1
+	if output == "":
+		output = dir.simplify_path() + ".pck"
+	output = get_cli_abs_path(output)
+	var ver: GodotVer = GodotVer.parse_godotver(engine_version if engine_version != "" else "4.0.0")
+	if ver == null or not ver.is_valid_semver():
+		print("Error: invalid engine version '" + engine_version + "'")
+		return -1
+	var creator: PckCreator = PckCreator.new()
+	creator.set_pack_version(2 if ver.get_major() >= 4 else 1)
+	creator.set_engine_version(ver.get_major(), ver.get_minor(), ver.get_patch())
+	creator.set_encrypt_filters(encrypt_globs, PackedStringArray())
+	creator.set_encrypt_dir(encrypt_dir)
+	if key != "":
+		if key.length() != 64:
+			print("Error: key must be a 64-character hex string")
+			return -1
+		creator.set_encryption_key(key.hex_decode())
+	creator.set_multi_thread(not disable_multi_threading)
+	var start_time = Time.get_ticks_msec()
+	var err = creator.pck_create(output, dir)
+	if err != OK:
+		print("Error: failed to create " + output + " (" + error_string(err) + ")")
+		return err
+	var secs_taken = (Time.get_ticks_msec() - start_time) / 1000.0
+	print("Created " + output + " in %.2fs" % secs_taken)
+	return OK
+
 func handle_cli(args: PackedStringArray) -> bool:
 	var input_extract_file:PackedStringArray = []
 	var input_file:PackedStringArray = []
@@ -654,6 +684,11 @@ func handle_cli(args: PackedStringArray) -> bool:
 	var main_cmds = {}
 	var excludes: PackedStringArray = []
 	var includes: PackedStringArray = []
+	var pck_create_dir: String = ""
+	var pck_output: String = ""
+	var pck_engine_version: String = ""
+	var pck_encrypt: PackedStringArray = []
+	var pck_encrypt_dir: bool = false
 	if (args.size() == 0):
 		return false
 	var any_commands = false
@@ -702,6 +737,8 @@ func handle_cli(args: PackedStringArray) -> bool:
 			translation_only = true
 		elif arg.begins_with("--disable-multithreading"):
 			disable_multi_threading = true
+		elif arg.begins_with("--use-pack-cache"):
+			GDRESettings.set_pack_index_cache_enabled(true)
 		elif arg.begins_with("--list-bytecode-versions"):
 			var versions = GDScriptDecomp.get_bytecode_versions()
 			print("\n--- Available bytecode versions:")
@@ -716,6 +753,17 @@ func handle_cli(args: PackedStringArray) -> bool:
 		elif arg.begins_with("--compile"):
 			main_cmds["compile"] = true
 			compile_files.append(get_arg_value(arg))
+		elif arg.begins_with("--pck-create"):
+			main_cmds["pck-create"] = true
+			pck_create_dir = get_arg_value(arg).simplify_path()
+		elif arg.begins_with("--pck-output"):
+			pck_output = get_arg_value(arg).simplify_path()
+		elif arg.begins_with("--pck-engine-version"):
+			pck_engine_version = get_arg_value(arg)
+		elif arg.begins_with("--pck-encrypt-dir"):
+			pck_encrypt_dir = true
+		elif arg.begins_with("--pck-encrypt"):
+			pck_encrypt.append(get_arg_value(arg))
 		elif arg.begins_with("--exclude"):
 			excludes.append(get_arg_value(arg))
 		elif arg.begins_with("--include"):
@@ -736,6 +784,8 @@ func handle_cli(args: PackedStringArray) -> bool:
 		compile(compile_files, bytecode_version, output_dir)
 	elif decompile_files.size() > 0:
 		decompile(decompile_files, bytecode_version, output_dir, enc_key)
+	elif pck_create_dir != "":
+		pck_create(pck_create_dir, pck_output, pck_engine_version, pck_encrypt, pck_encrypt_dir, enc_key)
 	elif not input_file.is_empty():
 		recovery(input_file, output_dir, enc_key, false, ignore_md5, excludes, includes)
 		GDRESettings.unload_project()
@@ -11,6 +11,7 @@
 #include "core/io/http_client_tcp.h"
 #include "core/io/image.h"
 #include "core/io/missing_resource.h"
+#include "core/templates/local_vector.h"
 #include "modules/zip/zip_reader.h"
 
 Vector<String> gdre::get_recursive_dir_list(const String dir, const Vector<String> &wildcards, const bool absolute, const String rel, const bool &res) {
@@ -86,37 +87,57 @@ Error gdre::decompress_image(const Ref<Image> &img) {
 	return OK;
 }
 
-class GodotFileInterface : public tga::FileInterface {
-	Ref<FileAccess> m_file;
+// The encoder writes a byte at a time, so it writes into memory and the result is stored with a single store_buffer()
+class BufferFileInterface : public tga::FileInterface {
+	LocalVector<uint8_t> m_data;
+	size_t m_pos = 0;
 
 public:
-	GodotFileInterface(const String &p_path, FileAccess::ModeFlags p_mode) {
-		m_file = FileAccess::open(p_path, p_mode);
+	BufferFileInterface(size_t p_reserve) {
+		m_data.reserve(p_reserve);
 	}
 	// Returns true if we can read/write bytes from/into the file
 	virtual bool ok() const override {
-		return m_file.is_valid();
+		return true;
 	};
 
 	// Current position in the file
 	virtual size_t tell() override {
-		return m_file->get_position();
+		return m_pos;
 	}
 
 	// Jump to the given position in the file
 	virtual void seek(size_t absPos) override {
-		m_file->seek(absPos);
+		m_pos = absPos;
 	};
 
 	// Returns the next byte in the file or 0 if ok() = false
 	virtual uint8_t read8() override {
-		return m_file->get_8();
+		return m_pos < m_data.size() ? m_data[m_pos++] : 0;
 	};
 
 	// Writes one byte in the file (or do nothing if ok() = false)
 	virtual void write8(uint8_t value) override {
-		m_file->store_8(value);
+		if (m_pos == m_data.size()) {
+			m_data.push_back(value);
+		} else {
+			if (m_pos > m_data.size()) {
+				// seeked past the end, zero-fill the gap
+				size_t old_size = m_data.size();
+				m_data.resize(m_pos + 1);
+				memset(m_data.ptr() + old_size, 0, m_pos - old_size);
+			}
+			m_data[m_pos] = value;
+		}
+		m_pos++;
 	};
+
+	const uint8_t *ptr() const {
+		return m_data.ptr();
+	}
+	size_t size() const {
+		return m_data.size();
+	}
 };
 
 Error gdre::save_image_as_tga(const String &p_path, const Ref<Image> &p_img) {
@@ -166,15 +187,18 @@ Error gdre::save_image_as_tga(const String &p_path, const Ref<Image> &p_img) {
 	tga_image.pixels = tga_data.ptrw();
 	tga_image.bytesPerPixel = isRGB ? 4 : 1;
 	tga_image.rowstride = width * tga_image.bytesPerPixel;
-	GodotFileInterface file_interface(p_path, FileAccess::WRITE);
-	if (!file_interface.ok()) {
-		return ERR_FILE_CANT_WRITE;
-	}
+	// header + pixels + footer; enough for the uncompressed case, which RLE only exceeds on pathological images
+	BufferFileInterface file_interface(18 + (size_t)width * height * (header.bitsPerPixel / 8) + 26);
 	tga::Encoder encoder(&file_interface);
 	encoder.writeHeader(header);
 	encoder.writeImage(header, tga_image);
 	encoder.writeFooter();
-	return OK;
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_FILE_CANT_WRITE, "Failed to open " + p_path + " for writing");
+	f->store_buffer(file_interface.ptr(), file_interface.size());
+	return f->get_error() == OK ? OK : ERR_FILE_CANT_WRITE;
 }
 
 Error gdre::save_image_as_webp(const String &p_path, const Ref<Image> &p_img, bool lossy) {
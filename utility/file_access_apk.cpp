@@ -111,16 +111,7 @@ static void godot_free(voidpf opaque, voidpf address) {
 }
 } // extern "C"
 
-void APKArchive::close_handle(unzFile p_file) const {
-	ERR_FAIL_COND_MSG(!p_file, "Cannot close a file if none is open.");
-	unzCloseCurrentFile(p_file);
-	unzClose(p_file);
-}
-
-unzFile APKArchive::get_file_handle(String p_file) const {
-	ERR_FAIL_COND_V_MSG(!file_exists(p_file), nullptr, "File '" + p_file + " doesn't exist.");
-	File file = files[p_file];
-
+static zlib_filefunc_def _get_io() {
 	zlib_filefunc_def io;
 	memset(&io, 0, sizeof(io));
 
@@ -136,14 +127,58 @@ unzFile APKArchive::get_file_handle(String p_file) const {
 
 	io.alloc_mem = godot_alloc;
 	io.free_mem = godot_free;
+	return io;
+}
 
-	unzFile pkg = unzOpen2(packages[file.package].filename.utf8().get_data(), &io);
-	ERR_FAIL_COND_V_MSG(!pkg, nullptr, "Cannot open file '" + packages[file.package].filename + "'.");
+// We don't need more idle handles than there are threads that could be reading at once
+static constexpr int MAX_POOLED_HANDLES = 64;
+
+unzFile APKArchive::_open_package_handle(int p_package) const {
+	zlib_filefunc_def io = _get_io();
+	unzFile pkg = unzOpen2(packages[p_package].filename.utf8().get_data(), &io);
+	ERR_FAIL_COND_V_MSG(!pkg, nullptr, "Cannot open file '" + packages[p_package].filename + "'.");
+	return pkg;
+}
+
+void APKArchive::close_handle(unzFile p_file, int p_package) const {
+	ERR_FAIL_COND_MSG(!p_file, "Cannot close a file if none is open.");
+	unzCloseCurrentFile(p_file);
+	{
+		MutexLock lock(handle_pool_mutex);
+		if (p_package >= 0 && p_package < handle_pool.size() && handle_pool[p_package].size() < MAX_POOLED_HANDLES) {
+			handle_pool.write[p_package].push_back(p_file);
+			return;
+		}
+	}
+	unzClose(p_file);
+}
+
+unzFile APKArchive::get_file_handle(String p_file, File *r_file) const {
+	ERR_FAIL_COND_V_MSG(!file_exists(p_file), nullptr, "File '" + p_file + " doesn't exist.");
+	File file = files[p_file];
+
+	unzFile pkg = nullptr;
+	{
+		MutexLock lock(handle_pool_mutex);
+		if (file.package < handle_pool.size() && !handle_pool[file.package].is_empty()) {
+			Vector<unzFile> &pool = handle_pool.write[file.package];
+			pkg = pool[pool.size() - 1];
+			pool.remove_at(pool.size() - 1);
+		}
+	}
+	if (!pkg) {
+		pkg = _open_package_handle(file.package);
+		ERR_FAIL_COND_V(!pkg, nullptr);
+	}
+	// Jumps straight to the entry's local header using the offsets we saved, no directory scan needed
 	int unz_err = unzGoToFilePos(pkg, &file.file_pos);
 	if (unz_err != UNZ_OK || unzOpenCurrentFile(pkg) != UNZ_OK) {
 		unzClose(pkg);
 		ERR_FAIL_V(nullptr);
 	}
+	if (r_file) {
+		*r_file = file;
+	}
 
 	return pkg;
 }
@@ -175,31 +210,26 @@ bool APKArchive::try_open_pack(const String &p_path, bool p_replace_files, uint6
 		return false;
 	}
 	bool is_apk = ext == "apk";
-	zlib_filefunc_def io;
-	memset(&io, 0, sizeof(io));
-
-	io.opaque = nullptr;
-	io.zopen_file = godot_open;
-	io.zread_file = godot_read;
-	io.zwrite_file = godot_write;
-
-	io.ztell_file = godot_tell;
-	io.zseek_file = godot_seek;
-	io.zclose_file = godot_close;
-	io.zerror_file = godot_testerror;
+	zlib_filefunc_def io = _get_io();
 
 	unzFile zfile = unzOpen2(pack_path.utf8().get_data(), &io);
 	ERR_FAIL_COND_V(!zfile, false);
 
 	unz_global_info64 gi;
 	int err = unzGetGlobalInfo64(zfile, &gi);
-	ERR_FAIL_COND_V(err != UNZ_OK, false);
+	if (err != UNZ_OK) {
+		unzClose(zfile);
+		ERR_FAIL_V(false);
+	}
 
 	Package pkg;
 	pkg.filename = pack_path;
-	pkg.zfile = zfile;
 	packages.push_back(pkg);
 	int pkg_num = packages.size() - 1;
+	{
+		MutexLock lock(handle_pool_mutex);
+		handle_pool.resize(packages.size());
+	}
 	uint32_t asset_count = 0;
 	uint32_t fmt_ver = 1;
 	Ref<GodotVer> godot_ver;
@@ -214,6 +244,7 @@ bool APKArchive::try_open_pack(const String &p_path, bool p_replace_files, uint6
 
 		File f;
 		f.package = pkg_num;
+		f.file_info = file_info;
 
 		unzGetFilePos(zfile, &f.file_pos);
 		String original_fname = String::utf8(filename_inzip);
@@ -261,6 +292,9 @@ bool APKArchive::try_open_pack(const String &p_path, bool p_replace_files, uint6
 			unzGoToNextFile(zfile);
 		}
 	}
+	// The handle we parsed the directory with becomes the first one in the pool
+	close_handle(zfile, pkg_num);
+
 	Ref<GDRESettings::PackInfo> pckinfo;
 	pckinfo.instantiate();
 	pckinfo->init(pack_path, godot_ver, fmt_ver, 0, 0, asset_count, is_apk ? GDRESettings::PackInfo::APK : GDRESettings::PackInfo::ZIP);
@@ -290,10 +324,12 @@ APKArchive::APKArchive() {
 }
 
 APKArchive::~APKArchive() {
-	for (int i = 0; i < packages.size(); i++) {
-		unzClose(packages[i].zfile);
+	for (int i = 0; i < handle_pool.size(); i++) {
+		for (unzFile handle : handle_pool[i]) {
+			unzClose(handle);
+		}
 	}
-
+	handle_pool.clear();
 	packages.clear();
 }
 
@@ -303,11 +339,11 @@ Error FileAccessAPK::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_COND_V(p_mode_flags & FileAccess::WRITE, FAILED);
 	APKArchive *arch = APKArchive::get_singleton();
 	ERR_FAIL_COND_V(!arch, FAILED);
-	zfile = arch->get_file_handle(p_path);
+	APKArchive::File file;
+	zfile = arch->get_file_handle(p_path, &file);
 	ERR_FAIL_COND_V(!zfile, FAILED);
-
-	int err = unzGetCurrentFileInfo64(zfile, &file_info, nullptr, 0, nullptr, 0, nullptr, 0);
-	ERR_FAIL_COND_V(err != UNZ_OK, FAILED);
+	package = file.package;
+	file_info = file.file_info;
 
 	return OK;
 }
@@ -319,27 +355,76 @@ void FileAccessAPK::_close() {
 
 	APKArchive *arch = APKArchive::get_singleton();
 	ERR_FAIL_COND(!arch);
-	arch->close_handle(zfile);
+	arch->close_handle(zfile, package);
 	zfile = nullptr;
+	package = -1;
+	entry_data.clear();
+	entry_buffered = false;
+	entry_pos = 0;
 }
 
 bool FileAccessAPK::is_open() const {
 	return zfile != nullptr;
 }
 
+// Largest deflated entry we'll inflate into memory to make seeking cheap; bigger ones keep seeking through minizip
+static constexpr uint64_t MAX_BUFFERED_ENTRY_SIZE = 64 * 1024 * 1024;
+
+bool FileAccessAPK::_buffer_entry() {
+	if (entry_buffered) {
+		return true;
+	}
+	// Stored entries can already be seeked directly
+	if (file_info.compression_method == 0 || file_info.uncompressed_size > MAX_BUFFERED_ENTRY_SIZE) {
+		return false;
+	}
+	uint64_t pos = unztell(zfile);
+	if (unzSeekCurrentFile(zfile, 0) != UNZ_OK) {
+		return false;
+	}
+	entry_data.resize(file_info.uncompressed_size);
+	uint64_t total = 0;
+	while (total < file_info.uncompressed_size) {
+		int64_t read = unzReadCurrentFile(zfile, entry_data.ptrw() + total, MIN(file_info.uncompressed_size - total, (uint64_t)INT32_MAX));
+		if (read <= 0) {
+			break;
+		}
+		total += read;
+	}
+	if (total != file_info.uncompressed_size) {
+		entry_data.clear();
+		unzSeekCurrentFile(zfile, pos);
+		return false;
+	}
+	entry_buffered = true;
+	entry_pos = pos;
+	return true;
+}
+
 void FileAccessAPK::seek(uint64_t p_position) {
 	ERR_FAIL_COND(!zfile);
 
+	at_eof = false;
+	if (!entry_buffered && p_position != unztell(zfile)) {
+		_buffer_entry();
+	}
+	if (entry_buffered) {
+		entry_pos = MIN(p_position, (uint64_t)entry_data.size());
+		return;
+	}
 	unzSeekCurrentFile(zfile, p_position);
 }
 
 void FileAccessAPK::seek_end(int64_t p_position) {
 	ERR_FAIL_COND(!zfile);
-	unzSeekCurrentFile(zfile, get_length() + p_position);
+	seek(get_length() + p_position);
 }
 
 uint64_t FileAccessAPK::get_position() const {
 	ERR_FAIL_COND_V(!zfile, 0);
+	if (entry_buffered) {
+		return entry_pos;
+	}
 	return unztell(zfile);
 }
 
@@ -364,6 +449,16 @@ uint64_t FileAccessAPK::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 	ERR_FAIL_COND_V(!zfile, -1);
 
+	if (entry_buffered) {
+		uint64_t read = MIN(p_length, entry_data.size() - entry_pos);
+		memcpy(p_dst, entry_data.ptr() + entry_pos, read);
+		entry_pos += read;
+		if (read < p_length) {
+			at_eof = true;
+		}
+		return read;
+	}
+
 	at_eof = unzeof(zfile);
 	if (at_eof) {
 		return 0;
@@ -34,6 +34,7 @@
 #ifdef MINIZIP_ENABLED
 
 #include "core/io/file_access_pack.h"
+#include "core/os/mutex.h"
 
 #include "thirdparty/minizip/unzip.h"
 
@@ -41,28 +42,36 @@
 
 class APKArchive : public PackSource {
 public:
+	// Everything we need to open an entry, taken from the central directory when the package is loaded.
 	struct File {
 		int package = -1;
 		unz_file_pos file_pos;
+		unz_file_info64 file_info;
 		File() {}
 	};
 
 private:
 	struct Package {
 		String filename;
-		unzFile zfile = nullptr;
 	};
 	Vector<Package> packages;
 
 	HashMap<String, File> files;
 
+	// Already opened unzFile handles for each package, ready to be reused.
+	// Opening a handle re-reads the end of central directory, so we only do it when every pooled handle is in use.
+	mutable Vector<Vector<unzFile>> handle_pool;
+	mutable Mutex handle_pool_mutex;
+
+	unzFile _open_package_handle(int p_package) const;
+
 	static APKArchive *instance;
 
 public:
 	Error get_version_string_from_manifest(String &version_string);
 
-	void close_handle(unzFile p_file) const;
-	unzFile get_file_handle(String p_file) const;
+	void close_handle(unzFile p_file, int p_package) const;
+	unzFile get_file_handle(String p_file, File *r_file = nullptr) const;
 
 	Error add_package(String p_name);
 
@@ -79,10 +88,18 @@ public:
 
 class FileAccessAPK : public FileAccess {
 	unzFile zfile = nullptr;
+	int package = -1;
 	unz_file_info64 file_info;
 
 	mutable bool at_eof = false;
 
+	// Deflated entries can only be seeked by inflating from the start again, so small enough entries
+	// are inflated once into memory the first time they are seeked and read from there afterwards.
+	Vector<uint8_t> entry_data;
+	bool entry_buffered = false;
+	mutable uint64_t entry_pos = 0;
+
+	bool _buffer_entry();
 	void _close();
 
 public:
@@ -0,0 +1,211 @@
+#include "file_access_encrypted_stream.h"
+
+#include "core/io/file_access_encrypted.h"
+
+Error FileAccessEncryptedStream::open_and_parse(const Ref<FileAccess> &p_base, const Vector<uint8_t> &p_key, bool p_with_magic) {
+	ERR_FAIL_COND_V_MSG(file.is_valid(), ERR_ALREADY_IN_USE, "Can't open file while another file from path '" + file->get_path_absolute() + "' is open.");
+	ERR_FAIL_COND_V(p_key.size() != 32, ERR_INVALID_PARAMETER);
+
+	pos = 0;
+	eofed = false;
+	chunk.clear();
+	chunk_index = -1;
+	hashed_size = 0;
+	md5_checked = false;
+	md5_failed = false;
+
+	if (p_with_magic) {
+		uint32_t magic = p_base->get_32();
+		ERR_FAIL_COND_V(magic != ENCRYPTED_HEADER_MAGIC, ERR_FILE_UNRECOGNIZED);
+	}
+	p_base->get_buffer(md5, 16);
+	length = p_base->get_64();
+	p_base->get_buffer(iv, 16);
+	base = p_base->get_position();
+	ERR_FAIL_COND_V(p_base->get_length() < base + length, ERR_FILE_CORRUPT);
+
+	key = p_key;
+	// CFB uses the encryption key schedule in both directions
+	aes.set_encode_key(key.ptrw(), 256);
+	md5_ctx.start();
+	file = p_base;
+	return OK;
+}
+
+Error FileAccessEncryptedStream::open_internal(const String &p_path, int p_mode_flags) {
+	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Use open_and_parse() to open a FileAccessEncryptedStream.");
+}
+
+bool FileAccessEncryptedStream::_load_chunk(uint64_t p_index) const {
+	uint64_t start = p_index * STREAMING_CHUNK_SIZE;
+	ERR_FAIL_COND_V(start >= length, false);
+	uint64_t plain_size = MIN(STREAMING_CHUNK_SIZE, length - start);
+	if (chunk_index != (int64_t)p_index) {
+		// Chunks are a multiple of the AES block size, so only the last one can be padded
+		uint64_t enc_size = plain_size;
+		if (enc_size % 16) {
+			enc_size += 16 - (enc_size % 16);
+		}
+		// In CFB mode each block is decrypted with the previous block's ciphertext, so any chunk can be decrypted on its own
+		uint8_t chunk_iv[16];
+		if (start == 0) {
+			memcpy(chunk_iv, iv, 16);
+			file->seek(base);
+		} else {
+			file->seek(base + start - 16);
+			if (file->get_buffer(chunk_iv, 16) != 16) {
+				chunk_index = -1;
+				ERR_FAIL_V_MSG(false, "Failed to read encrypted data from " + file->get_path() + ".");
+			}
+		}
+		chunk.resize(enc_size);
+		if (file->get_buffer(chunk.ptrw(), enc_size) != enc_size) {
+			chunk_index = -1;
+			ERR_FAIL_V_MSG(false, "Failed to read encrypted data from " + file->get_path() + ".");
+		}
+		aes.decrypt_cfb(enc_size, chunk_iv, chunk.ptrw(), chunk.ptrw());
+		chunk_index = p_index;
+	}
+	// Chunks are hashed the first time they're read in order; anything that's skipped over gets hashed on close.
+	if (!md5_checked && start == hashed_size) {
+		md5_ctx.update(chunk.ptr(), plain_size);
+		hashed_size += plain_size;
+		if (hashed_size == length) {
+			_finish_md5();
+		}
+	}
+	return true;
+}
+
+void FileAccessEncryptedStream::_finish_md5() const {
+	if (md5_checked) {
+		return;
+	}
+	while (hashed_size < length) {
+		if (!_load_chunk(hashed_size / STREAMING_CHUNK_SIZE)) {
+			md5_failed = true;
+			md5_checked = true;
+			return;
+		}
+		if (md5_checked) {
+			// _load_chunk() hashed the last chunk and finished for us
+			return;
+		}
+	}
+	unsigned char hash[16];
+	md5_ctx.finish(hash);
+	md5_checked = true;
+	if (memcmp(hash, md5, 16) != 0) {
+		md5_failed = true;
+		ERR_PRINT("The MD5 sum of the decrypted file '" + file->get_path() + "' does not match the expected value. It could be that the file is corrupt, or that the provided decryption key is invalid.");
+	}
+}
+
+bool FileAccessEncryptedStream::is_open() const {
+	return file.is_valid();
+}
+
+String FileAccessEncryptedStream::get_path() const {
+	if (file.is_valid()) {
+		return file->get_path();
+	}
+	return "";
+}
+
+String FileAccessEncryptedStream::get_path_absolute() const {
+	if (file.is_valid()) {
+		return file->get_path_absolute();
+	}
+	return "";
+}
+
+void FileAccessEncryptedStream::seek(uint64_t p_position) {
+	if (p_position > length) {
+		p_position = length;
+	}
+	pos = p_position;
+	eofed = false;
+}
+
+void FileAccessEncryptedStream::seek_end(int64_t p_position) {
+	seek(length + p_position);
+}
+
+uint64_t FileAccessEncryptedStream::get_position() const {
+	return pos;
+}
+
+uint64_t FileAccessEncryptedStream::get_length() const {
+	return length;
+}
+
+bool FileAccessEncryptedStream::eof_reached() const {
+	return eofed;
+}
+
+uint8_t FileAccessEncryptedStream::get_8() const {
+	uint8_t b = 0;
+	get_buffer(&b, 1);
+	return b;
+}
+
+uint64_t FileAccessEncryptedStream::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+	ERR_FAIL_COND_V(file.is_null(), -1);
+
+	uint64_t to_copy = MIN(p_length, length - pos);
+	uint64_t copied = 0;
+	while (copied < to_copy) {
+		uint64_t index = pos / STREAMING_CHUNK_SIZE;
+		if (!_load_chunk(index)) {
+			break;
+		}
+		uint64_t chunk_pos = pos - index * STREAMING_CHUNK_SIZE;
+		uint64_t chunk_size = MIN(STREAMING_CHUNK_SIZE, length - index * STREAMING_CHUNK_SIZE);
+		uint64_t n = MIN(to_copy - copied, chunk_size - chunk_pos);
+		memcpy(p_dst + copied, chunk.ptr() + chunk_pos, n);
+		copied += n;
+		pos += n;
+	}
+	if (copied < p_length) {
+		eofed = true;
+	}
+	return copied;
+}
+
+Error FileAccessEncryptedStream::get_error() const {
+	if (md5_failed) {
+		return ERR_FILE_CORRUPT;
+	}
+	return eofed ? ERR_FILE_EOF : OK;
+}
+
+void FileAccessEncryptedStream::flush() {
+	ERR_FAIL();
+}
+
+bool FileAccessEncryptedStream::store_8(uint8_t p_dest) {
+	ERR_FAIL_V(false);
+}
+
+bool FileAccessEncryptedStream::store_buffer(const uint8_t *p_src, uint64_t p_length) {
+	ERR_FAIL_V(false);
+}
+
+bool FileAccessEncryptedStream::file_exists(const String &p_name) {
+	return false;
+}
+
+void FileAccessEncryptedStream::close() {
+	if (file.is_null()) {
+		return;
+	}
+	_finish_md5();
+	chunk.clear();
+	chunk_index = -1;
+	file.unref();
+}
+
+FileAccessEncryptedStream::~FileAccessEncryptedStream() {
+	close();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "core/crypto/crypto_core.h"
+#include "core/io/file_access.h"
+
+// Read-only access to a file in FileAccessEncrypted's format (AES-256-CFB, as used for encrypted pack entries)
+// that decrypts it a chunk at a time as it's read, instead of decrypting the whole file into memory on open.
+// The MD5 is checked once every chunk has been seen (at the latest on close); a mismatch is reported by get_error().
+class FileAccessEncryptedStream : public FileAccess {
+	GDCLASS(FileAccessEncryptedStream, FileAccess);
+
+	Ref<FileAccess> file;
+	Vector<uint8_t> key;
+	uint64_t base = 0;
+	uint64_t length = 0;
+	uint8_t md5[16] = {};
+	uint8_t iv[16] = {};
+	mutable uint64_t pos = 0;
+	mutable bool eofed = false;
+
+	mutable CryptoCore::AESContext aes;
+	mutable Vector<uint8_t> chunk;
+	mutable int64_t chunk_index = -1;
+	mutable CryptoCore::MD5Context md5_ctx;
+	mutable uint64_t hashed_size = 0;
+	mutable bool md5_checked = false;
+	mutable bool md5_failed = false;
+
+	bool _load_chunk(uint64_t p_index) const;
+	void _finish_md5() const;
+
+public:
+	// Files smaller than this are cheaper to decrypt in one go with FileAccessEncrypted.
+	static constexpr uint64_t STREAMING_MIN_SIZE = 4 * 1024 * 1024;
+	static constexpr uint64_t STREAMING_CHUNK_SIZE = 64 * 1024;
+
+	Error open_and_parse(const Ref<FileAccess> &p_base, const Vector<uint8_t> &p_key, bool p_with_magic = true);
+
+	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
+	virtual bool is_open() const override; ///< true when file is open
+
+	virtual String get_path() const override; /// returns the path for the current open file
+	virtual String get_path_absolute() const override; /// returns the absolute path for the current open file
+
+	virtual void seek(uint64_t p_position) override; ///< seek to a given position
+	virtual void seek_end(int64_t p_position = 0) override; ///< seek from the end of file
+	virtual uint64_t get_position() const override; ///< get position in the file
+	virtual uint64_t get_length() const override; ///< get size of the file
+
+	virtual bool eof_reached() const override; ///< reading passed EOF
+
+	virtual uint8_t get_8() const override; ///< get a byte
+	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+
+	virtual Error get_error() const override; ///< get last error
+
+	virtual Error resize(int64_t p_length) override { return ERR_UNAVAILABLE; }
+	virtual void flush() override;
+	virtual bool store_8(uint8_t p_dest) override; ///< store a byte
+	virtual bool store_buffer(const uint8_t *p_src, uint64_t p_length) override; ///< store an array of bytes
+
+	virtual bool file_exists(const String &p_name) override; ///< return true if a file exists
+
+	virtual void close() override;
+
+	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
+	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
+	virtual Error _set_unix_permissions(const String &p_file, BitField<FileAccess::UnixPermissionFlags> p_permissions) override { return FAILED; }
+
+	virtual bool _get_hidden_attribute(const String &p_file) override { return false; }
+	virtual Error _set_hidden_attribute(const String &p_file, bool p_hidden) override { return ERR_UNAVAILABLE; }
+	virtual bool _get_read_only_attribute(const String &p_file) override { return true; }
+	virtual Error _set_read_only_attribute(const String &p_file, bool p_ro) override { return ERR_UNAVAILABLE; }
+
+	FileAccessEncryptedStream() {}
+	~FileAccessEncryptedStream();
+};
@@ -9,6 +9,8 @@
 #include "gdre_settings.h"
 #include "packed_file_info.h"
 
+#include "core/templates/sort_array.h"
+
 bool is_gdre_file(const String &p_path) {
 	return p_path.begins_with("res://") && p_path.get_basename().begins_with("gdre_");
 }
@@ -17,24 +19,279 @@ GDREPackedData *GDREPackedData::singleton = nullptr;
 
 GDREPackedData::GDREPackedData() {
 	singleton = this;
-	root = memnew(PackedDir);
+	_clear_index();
+}
+
+uint32_t GDREPackedData::_intern(const String &p_str, LocalVector<String> &r_table, HashMap<String, uint32_t> &r_ids) {
+	HashMap<String, uint32_t>::Iterator E = r_ids.find(p_str);
+	if (E) {
+		return E->value;
+	}
+	uint32_t id = r_table.size();
+	r_table.push_back(p_str);
+	r_ids.insert(p_str, id);
+	return id;
+}
+
+uint32_t GDREPackedData::_get_or_add_dir(uint32_t p_parent, const String &p_name) {
+	uint32_t name = _intern(p_name, names, name_ids);
+	uint64_t key = ((uint64_t)p_parent << 32) | name;
+	HashMap<uint64_t, uint32_t>::Iterator E = dir_lookup.find(key);
+	if (E) {
+		return E->value;
+	}
+	PackedDir pd;
+	pd.parent = p_parent;
+	pd.name = name;
+	pd.path = dirs[p_parent].path + p_name + "/";
+	uint32_t idx = dirs.size();
+	dirs.push_back(pd);
+	dir_lookup.insert(key, idx);
+	dir_index_dirty = true;
+	return idx;
+}
+
+uint32_t GDREPackedData::_find_subdir(uint32_t p_dir, const String &p_name) const {
+	HashMap<String, uint32_t>::ConstIterator N = name_ids.find(p_name);
+	if (!N) {
+		return INVALID_INDEX;
+	}
+	HashMap<uint64_t, uint32_t>::ConstIterator E = dir_lookup.find(((uint64_t)p_dir << 32) | N->value);
+	return E ? E->value : INVALID_INDEX;
+}
+
+bool GDREPackedData::_dir_has_file(uint32_t p_dir, const String &p_name) const {
+	if (p_name.is_empty()) {
+		return false;
+	}
+	return path_index.has(PathMD5((dirs[p_dir].path + p_name).md5_buffer()));
+}
+
+namespace {
+struct EntryNameComparator {
+	const String *names = nullptr;
+	const GDREPackedData::PackedEntry *entries = nullptr;
+	_FORCE_INLINE_ bool operator()(uint32_t a, uint32_t b) const {
+		return names[entries[a].name] < names[entries[b].name];
+	}
+};
+
+struct DirNameComparator {
+	const String *names = nullptr;
+	const GDREPackedData::PackedDir *dirs = nullptr;
+	_FORCE_INLINE_ bool operator()(uint32_t a, uint32_t b) const {
+		return names[dirs[a].name] < names[dirs[b].name];
+	}
+};
+} // namespace
+
+// Rebuilds the child spans of every directory from the entries; only needed when something walks the tree.
+void GDREPackedData::_update_dir_index() {
+	MutexLock lock(lazy_mutex);
+	if (!dir_index_dirty) {
+		return;
+	}
+	for (PackedDir &pd : dirs) {
+		pd.subdirs_count = 0;
+		pd.files_count = 0;
+	}
+	for (uint32_t i = 1; i < dirs.size(); i++) {
+		dirs[dirs[i].parent].subdirs_count++;
+	}
+	// the root's name is the empty string
+	uint32_t empty_name = dirs[0].name;
+	for (const PackedEntry &e : entries) {
+		// Don't add as a file if the path points to a directory
+		if (e.name != empty_name) {
+			dirs[e.dir].files_count++;
+		}
+	}
+	uint32_t subdirs_total = 0;
+	uint32_t files_total = 0;
+	for (PackedDir &pd : dirs) {
+		pd.subdirs_start = subdirs_total;
+		pd.files_start = files_total;
+		subdirs_total += pd.subdirs_count;
+		files_total += pd.files_count;
+		pd.subdirs_count = 0;
+		pd.files_count = 0;
+	}
+	dir_subdirs.resize(subdirs_total);
+	dir_files.resize(files_total);
+	for (uint32_t i = 1; i < dirs.size(); i++) {
+		PackedDir &parent = dirs[dirs[i].parent];
+		dir_subdirs[parent.subdirs_start + parent.subdirs_count++] = i;
+	}
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		const PackedEntry &e = entries[i];
+		if (e.name != empty_name) {
+			PackedDir &pd = dirs[e.dir];
+			dir_files[pd.files_start + pd.files_count++] = i;
+		}
+	}
+	SortArray<uint32_t, DirNameComparator> dir_sorter;
+	dir_sorter.compare.names = names.ptr();
+	dir_sorter.compare.dirs = dirs.ptr();
+	SortArray<uint32_t, EntryNameComparator> file_sorter;
+	file_sorter.compare.names = names.ptr();
+	file_sorter.compare.entries = entries.ptr();
+	for (const PackedDir &pd : dirs) {
+		if (pd.subdirs_count > 1) {
+			dir_sorter.sort(dir_subdirs.ptr() + pd.subdirs_start, pd.subdirs_count);
+		}
+		if (pd.files_count > 1) {
+			file_sorter.sort(dir_files.ptr() + pd.files_start, pd.files_count);
+		}
+	}
+	dir_index_dirty = false;
+}
+
+String GDREPackedData::_get_entry_path(uint32_t p_idx) const {
+	const String *override_path = path_overrides.getptr(p_idx);
+	if (override_path) {
+		return *override_path;
+	}
+	const PackedEntry &e = entries[p_idx];
+	return dirs[e.dir].path + names[e.name];
+}
+
+PackedData::PackedFile GDREPackedData::_make_packed_file(uint32_t p_idx) const {
+	const PackedEntry &e = entries[p_idx];
+	PackedData::PackedFile pf;
+	pf.pack = packs[e.pack];
+	pf.offset = e.offset;
+	pf.size = e.size;
+	memcpy(pf.md5, e.md5, 16);
+	pf.src = e.src;
+	pf.encrypted = e.encrypted;
+	return pf;
+}
+
+// Infos aren't kept around; anything they need to remember (the checksum result) lives in the entry.
+Ref<PackedFileInfo> GDREPackedData::_make_file_info(uint32_t p_idx) const {
+	PackedData::PackedFile pf = _make_packed_file(p_idx);
+	const String *raw_path = raw_paths.getptr(p_idx);
+	Ref<PackedFileInfo> pf_info;
+	pf_info.instantiate();
+	pf_info->init(raw_path ? *raw_path : _get_entry_path(p_idx), &pf);
+	pf_info->md5_passed = entries[p_idx].md5_passed;
+	return pf_info;
+}
+
+void GDREPackedData::set_md5_match(const String &p_path, bool p_pass) {
+	HashMap<PathMD5, uint32_t, PathMD5>::Iterator E = path_index.find(PathMD5(p_path.md5_buffer()));
+	if (E) {
+		entries[E->value].md5_passed = p_pass;
+	}
 }
 
+void GDREPackedData::_update_ext_index() {
+	MutexLock lock(lazy_mutex);
+	if (!ext_index_dirty) {
+		return;
+	}
+	ext_index.clear();
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		ext_index[names[entries[i].name].get_extension().to_lower()].push_back(i);
+	}
+	ext_index_dirty = false;
+}
+
+// Adds every file under p_dir (recursively) to r_indices
+void GDREPackedData::_get_subtree_entries(uint32_t p_dir, LocalVector<uint32_t> &r_indices) const {
+	const PackedDir &pd = dirs[p_dir];
+	for (uint32_t i = 0; i < pd.files_count; i++) {
+		r_indices.push_back(dir_files[pd.files_start + i]);
+	}
+	for (uint32_t i = 0; i < pd.subdirs_count; i++) {
+		_get_subtree_entries(dir_subdirs[pd.subdirs_start + i], r_indices);
+	}
+}
+
+namespace {
+bool has_wildcards(const String &p_str) {
+	return p_str.contains("*") || p_str.contains("?");
+}
+} // namespace
+
+// Filters without a '/' are matched against the file name, filters with one against the whole path.
+// "*.ext" and "res://dir/**" style filters are answered from the extension and directory indices;
+// anything else falls back to matching every file.
 Vector<Ref<PackedFileInfo>> GDREPackedData::get_file_info_list(const Vector<String> &filters) {
 	Vector<Ref<PackedFileInfo>> ret;
-	bool no_filters = !filters.size();
-	for (auto E : file_map) {
-		if (no_filters) {
-			ret.push_back(E.value);
+	if (!filters.size()) {
+		ret.resize(entries.size());
+		for (uint32_t i = 0; i < entries.size(); i++) {
+			ret.write[i] = _make_file_info(i);
+		}
+		return ret;
+	}
+	LocalVector<uint32_t> matches;
+	Vector<String> name_filters;
+	Vector<String> path_filters;
+	for (const String &filter : filters) {
+		if (filter.contains("/")) {
+			// "res://dir/**" or "res://dir/*"; "*" matches '/' as well, so both are the whole subtree
+			String prefix = filter.trim_suffix("**").trim_suffix("*");
+			if (prefix.ends_with("/") && prefix.begins_with("res://") && !has_wildcards(prefix)) {
+				_update_dir_index();
+				uint32_t dir = 0;
+				Vector<String> parts = prefix.trim_prefix("res://").trim_suffix("/").split("/", false);
+				for (int i = 0; i < parts.size() && dir != INVALID_INDEX; i++) {
+					dir = _find_subdir(dir, parts[i]);
+				}
+				if (dir != INVALID_INDEX) {
+					_get_subtree_entries(dir, matches);
+				}
+				continue;
+			}
+			path_filters.push_back(filter);
 			continue;
 		}
-		for (int j = 0; j < filters.size(); j++) {
-			if (E.key.get_file().match(filters[j])) {
-				ret.push_back(E.value);
-				break;
+		String ext = filter.trim_prefix("*.");
+		if (filter.begins_with("*.") && !ext.contains(".") && !has_wildcards(ext)) {
+			_update_ext_index();
+			const LocalVector<uint32_t> *E = ext_index.getptr(ext.to_lower());
+			if (E) {
+				// the index is case insensitive, match() isn't
+				String suffix = "." + ext;
+				for (uint32_t idx : *E) {
+					if (names[entries[idx].name].ends_with(suffix)) {
+						matches.push_back(idx);
+					}
+				}
+			}
+			continue;
+		}
+		name_filters.push_back(filter);
+	}
+	if (!name_filters.is_empty() || !path_filters.is_empty()) {
+		for (uint32_t i = 0; i < entries.size(); i++) {
+			const String *override_path = path_overrides.getptr(i);
+			String file_name = override_path ? override_path->get_file() : names[entries[i].name];
+			bool matched = false;
+			for (int j = 0; j < name_filters.size() && !matched; j++) {
+				matched = file_name.match(name_filters[j]);
+			}
+			if (!matched && !path_filters.is_empty()) {
+				String path = _get_entry_path(i);
+				for (int j = 0; j < path_filters.size() && !matched; j++) {
+					matched = path.match(path_filters[j]);
+				}
+			}
+			if (matched) {
+				matches.push_back(i);
 			}
 		}
 	}
+	// Keep the results in pack order, without duplicates
+	matches.sort();
+	for (uint32_t i = 0; i < matches.size(); i++) {
+		if (i > 0 && matches[i] == matches[i - 1]) {
+			continue;
+		}
+		ret.push_back(_make_file_info(matches[i]));
+	}
 	return ret;
 }
 
@@ -45,57 +302,58 @@ void GDREPackedData::add_pack_source(PackSource *p_source) {
 }
 
 void GDREPackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_pck_src) {
-	PackedData::PackedFile pf;
-	pf.encrypted = p_encrypted;
-	pf.pack = p_pkg_path;
-	pf.offset = p_ofs;
-	pf.size = p_size;
-	for (int i = 0; i < 16; i++) {
-		pf.md5[i] = p_md5[i];
-	}
-	pf.src = p_src;
-	Ref<PackedFileInfo> pf_info;
-	pf_info.instantiate();
-	pf_info->init(p_path, &pf);
-
 	// Get the fixed path if this is from a PCK source
-	String path = p_pck_src ? pf_info->get_path() : p_path;
+	bool malformed = false;
+	String path = p_pck_src ? PackedFileInfo::get_fixed_path(p_path, malformed) : p_path;
 
 	PathMD5 pmd5(path.md5_buffer());
 
-	bool exists = files.has(pmd5);
-
-	if (!exists || p_replace_files) {
-		files[pmd5] = pf;
-		file_map[path] = pf_info;
+	HashMap<PathMD5, uint32_t, PathMD5>::Iterator E = path_index.find(pmd5);
+	bool exists = bool(E);
+	if (exists && !p_replace_files) {
+		return;
 	}
 
-	if (!exists) {
+	uint32_t idx;
+	if (exists) {
+		idx = E->value;
+	} else {
 		//search for dir
 		String p = path.replace_first("res://", "");
-		PackedDir *cd = root;
+		uint32_t cd = 0;
 
 		if (p.contains("/")) { //in a subdir
-
 			Vector<String> ds = p.get_base_dir().split("/");
 
 			for (int j = 0; j < ds.size(); j++) {
-				if (!cd->subdirs.has(ds[j])) {
-					PackedDir *pd = memnew(PackedDir);
-					pd->name = ds[j];
-					pd->parent = cd;
-					cd->subdirs[pd->name] = pd;
-					cd = pd;
-				} else {
-					cd = cd->subdirs[ds[j]];
-				}
+				cd = _get_or_add_dir(cd, ds[j]);
 			}
 		}
-		String filename = path.get_file();
-		// Don't add as a file if the path points to a directory
-		if (!filename.is_empty()) {
-			cd->files.insert(filename);
+		PackedEntry e;
+		e.dir = cd;
+		e.name = _intern(path.get_file(), names, name_ids);
+		idx = entries.size();
+		entries.push_back(e);
+		path_index.insert(pmd5, idx);
+		if (_get_entry_path(idx) != path) {
+			path_overrides[idx] = path;
 		}
+		dir_index_dirty = true;
+		ext_index_dirty = true;
+	}
+
+	PackedEntry &e = entries[idx];
+	e.encrypted = p_encrypted;
+	e.md5_passed = false;
+	e.pack = _intern(p_pkg_path, packs, pack_ids);
+	e.offset = p_ofs;
+	e.size = p_size;
+	memcpy(e.md5, p_md5, 16);
+	e.src = p_src;
+	if (p_path != path) {
+		raw_paths[idx] = p_path;
+	} else {
+		raw_paths.erase(idx);
 	}
 }
 
@@ -144,19 +402,21 @@ Error GDREPackedData::add_pack(const String &p_path, bool p_replace_files, uint6
 Ref<FileAccess> GDREPackedData::try_open_path(const String &p_path) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
-	HashMap<PathMD5, PackedData::PackedFile, PathMD5>::Iterator E = files.find(pmd5);
+	HashMap<PathMD5, uint32_t, PathMD5>::Iterator E = path_index.find(pmd5);
 	if (!E) {
 		return nullptr; //not found
 	}
-	if (E->value.offset == 0) {
+	const PackedEntry &e = entries[E->value];
+	if (e.offset == 0) {
 		return nullptr; //was erased
 	}
 
-	return E->value.src->get_file(p_path, &E->value);
+	PackedData::PackedFile pf = _make_packed_file(E->value);
+	return e.src->get_file(p_path, &pf);
 }
 
 bool GDREPackedData::has_path(const String &p_path) {
-	return files.has(PathMD5(p_path.simplify_path().md5_buffer()));
+	return path_index.has(PathMD5(p_path.simplify_path().md5_buffer()));
 }
 
 Ref<DirAccess> GDREPackedData::try_open_directory(const String &p_path) {
@@ -174,15 +434,8 @@ bool GDREPackedData::has_directory(const String &p_path) {
 	}
 	return false;
 }
-void GDREPackedData::_free_packed_dirs(GDREPackedData::PackedDir *p_dir) {
-	for (const KeyValue<String, PackedDir *> &E : p_dir->subdirs) {
-		_free_packed_dirs(E.value);
-	}
-	memdelete(p_dir);
-}
-
 bool GDREPackedData::has_loaded_packs() {
-	return !sources.is_empty() && !files.is_empty();
+	return !sources.is_empty() && !entries.is_empty();
 }
 
 // Test for the existence of project.godot or project.binary in the packed data
@@ -202,10 +455,30 @@ void GDREPackedData::_clear() {
 	}
 	sources.clear();
 	set_disabled(true);
-	_free_packed_dirs(root);
-	root = memnew(PackedDir);
-	file_map.clear();
-	files.clear();
+	_clear_index();
+}
+
+void GDREPackedData::_clear_index() {
+	entries.clear();
+	path_index.clear();
+	raw_paths.clear();
+	path_overrides.clear();
+	names.clear();
+	name_ids.clear();
+	packs.clear();
+	pack_ids.clear();
+	dirs.clear();
+	dir_lookup.clear();
+	dir_subdirs.clear();
+	dir_files.clear();
+	ext_index.clear();
+	ext_index_dirty = true;
+	// the root directory is always index 0
+	PackedDir root;
+	root.path = "res://";
+	root.name = _intern(String(), names, name_ids);
+	dirs.push_back(root);
+	dir_index_dirty = true;
 }
 
 GDREPackedData::~GDREPackedData() {
@@ -392,18 +665,21 @@ Error DirAccessGDRE::list_dir_begin() {
 	if (proxy.is_valid()) {
 		return proxy->list_dir_begin();
 	}
-	if (!current) {
+	if (current == GDREPackedData::INVALID_INDEX) {
 		return ERR_UNCONFIGURED;
 	}
 	list_dirs.clear();
 	list_files.clear();
 
-	for (const KeyValue<String, GDREPackedData::PackedDir *> &E : current->subdirs) {
-		list_dirs.push_back(E.key);
+	GDREPackedData *pd = GDREPackedData::get_singleton();
+	pd->_update_dir_index();
+	const GDREPackedData::PackedDir &dir = pd->dirs[current];
+	for (uint32_t i = 0; i < dir.subdirs_count; i++) {
+		list_dirs.push_back(pd->names[pd->dirs[pd->dir_subdirs[dir.subdirs_start + i]].name]);
 	}
 
-	for (const String &E : current->files) {
-		list_files.push_back(E);
+	for (uint32_t i = 0; i < dir.files_count; i++) {
+		list_files.push_back(pd->names[pd->entries[pd->dir_files[dir.files_start + i]].name]);
 	}
 
 	return OK;
@@ -482,15 +758,16 @@ bool DirAccessGDRE::drives_are_shortcuts() {
 }
 
 // internal method
-GDREPackedData::PackedDir *DirAccessGDRE::_find_dir(String p_dir) {
-	if (!current) {
-		return nullptr;
+uint32_t DirAccessGDRE::_find_dir(String p_dir) {
+	if (current == GDREPackedData::INVALID_INDEX) {
+		return GDREPackedData::INVALID_INDEX;
 	}
+	GDREPackedData *packed_data = GDREPackedData::get_singleton();
 	String nd = p_dir.replace("\\", "/");
 
 	// Special handling since simplify_path() will forbid it
 	if (p_dir == "..") {
-		return current->parent;
+		return packed_data->dirs[current].parent;
 	}
 
 	bool absolute = false;
@@ -512,10 +789,10 @@ GDREPackedData::PackedDir *DirAccessGDRE::_find_dir(String p_dir) {
 
 	Vector<String> paths = nd.split("/");
 
-	GDREPackedData::PackedDir *pd;
+	uint32_t pd;
 
 	if (absolute) {
-		pd = GDREPackedData::get_singleton()->root;
+		pd = 0;
 	} else {
 		pd = current;
 	}
@@ -525,14 +802,14 @@ GDREPackedData::PackedDir *DirAccessGDRE::_find_dir(String p_dir) {
 		if (p == ".") {
 			continue;
 		} else if (p == "..") {
-			if (pd->parent) {
-				pd = pd->parent;
+			if (packed_data->dirs[pd].parent != GDREPackedData::INVALID_INDEX) {
+				pd = packed_data->dirs[pd].parent;
 			}
-		} else if (pd->subdirs.has(p)) {
-			pd = pd->subdirs[p];
-
 		} else {
-			return nullptr;
+			pd = packed_data->_find_subdir(pd, p);
+			if (pd == GDREPackedData::INVALID_INDEX) {
+				return GDREPackedData::INVALID_INDEX;
+			}
 		}
 	}
 
@@ -543,11 +820,11 @@ Error DirAccessGDRE::change_dir(String p_dir) {
 	if (proxy.is_valid()) {
 		return proxy->change_dir(p_dir);
 	}
-	if (!current) {
+	if (current == GDREPackedData::INVALID_INDEX) {
 		return ERR_UNCONFIGURED;
 	}
-	GDREPackedData::PackedDir *pd = _find_dir(p_dir);
-	if (pd) {
+	uint32_t pd = _find_dir(p_dir);
+	if (pd != GDREPackedData::INVALID_INDEX) {
 		current = pd;
 		return OK;
 	} else {
@@ -559,18 +836,15 @@ String DirAccessGDRE::get_current_dir(bool p_include_drive) const {
 	if (proxy.is_valid()) {
 		return proxy->get_current_dir(p_include_drive);
 	}
-	if (!current) {
+	if (current == GDREPackedData::INVALID_INDEX) {
 		return "";
 	}
-	GDREPackedData::PackedDir *pd = current;
-	String p = current->name;
-
-	while (pd->parent) {
-		pd = pd->parent;
-		p = pd->name.path_join(p);
+	if (current == 0) {
+		return "res://";
 	}
-
-	return "res://" + p;
+	// directory paths are stored with a trailing slash
+	const String &path = GDREPackedData::get_singleton()->dirs[current].path;
+	return path.substr(0, path.length() - 1);
 }
 
 bool DirAccessGDRE::file_exists(String p_file) {
@@ -579,11 +853,11 @@ bool DirAccessGDRE::file_exists(String p_file) {
 	}
 	p_file = fix_path(p_file);
 
-	GDREPackedData::PackedDir *pd = _find_dir(p_file.get_base_dir());
-	if (!pd) {
+	uint32_t pd = _find_dir(p_file.get_base_dir());
+	if (pd == GDREPackedData::INVALID_INDEX) {
 		return false;
 	}
-	return pd->files.has(p_file.get_file());
+	return GDREPackedData::get_singleton()->_dir_has_file(pd, p_file.get_file());
 }
 
 bool DirAccessGDRE::dir_exists(String p_dir) {
@@ -592,7 +866,7 @@ bool DirAccessGDRE::dir_exists(String p_dir) {
 	}
 	p_dir = fix_path(p_dir);
 
-	return _find_dir(p_dir) != nullptr;
+	return _find_dir(p_dir) != GDREPackedData::INVALID_INDEX;
 }
 
 bool DirAccessGDRE::is_readable(String p_dir) {
@@ -680,9 +954,9 @@ Error DirAccessGDRE::create_link(String p_source, String p_target) {
 DirAccessGDRE::DirAccessGDRE() {
 	if (GDREPackedData::get_singleton()->is_disabled() || !GDREPackedData::get_singleton()->has_loaded_packs()) {
 		proxy = _open_filesystem();
-		current = nullptr;
+		current = GDREPackedData::INVALID_INDEX;
 	} else {
-		current = GDREPackedData::get_singleton()->root;
+		current = 0;
 		proxy = Ref<DirAccess>();
 	}
 }
@@ -3,6 +3,8 @@
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/file_access_pack.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "utility/packed_file_info.h"
 
 class GDREPackedData {
@@ -11,11 +13,31 @@ class GDREPackedData {
 	friend class PackSource;
 
 public:
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+	// Directories live in one flat array; their children are sorted spans of `dir_subdirs` and `dir_files`,
+	// which are (re)built the first time the directory tree is walked after files were added.
 	struct PackedDir {
-		PackedDir *parent = nullptr;
-		String name;
-		HashMap<String, PackedDir *> subdirs;
-		HashSet<String> files;
+		uint32_t parent = INVALID_INDEX;
+		uint32_t name = 0; // index into `names`
+		String path; // "res://some/dir/", shared by every file in it
+		uint32_t subdirs_start = 0;
+		uint32_t subdirs_count = 0;
+		uint32_t files_start = 0;
+		uint32_t files_count = 0;
+	};
+
+	// Everything we know about a file; PackedData::PackedFile and PackedFileInfo are only created from this when asked for.
+	struct PackedEntry {
+		uint64_t offset = 0;
+		uint64_t size = 0;
+		PackSource *src = nullptr;
+		uint32_t dir = 0; // index into `dirs`
+		uint32_t name = 0; // index into `names`
+		uint32_t pack = 0; // index into `packs`
+		bool encrypted = false;
+		bool md5_passed = false;
+		uint8_t md5[16] = {};
 	};
 
 	struct PathMD5 {
@@ -39,24 +61,54 @@ public:
 	};
 
 private:
-	HashMap<PathMD5, PackedData::PackedFile, PathMD5> files;
-	HashMap<String, Ref<PackedFileInfo>> file_map;
+	LocalVector<PackedEntry> entries;
+	HashMap<PathMD5, uint32_t, PathMD5> path_index;
+	// Only set for entries whose original path differs from the one they are stored under (i.e. malformed paths)
+	HashMap<uint32_t, String> raw_paths;
+	// Only set for entries whose path can't be rebuilt from their directory and name
+	HashMap<uint32_t, String> path_overrides;
+
+	LocalVector<String> names;
+	HashMap<String, uint32_t> name_ids;
+	LocalVector<String> packs;
+	HashMap<String, uint32_t> pack_ids;
+
+	LocalVector<PackedDir> dirs;
+	HashMap<uint64_t, uint32_t> dir_lookup; // (parent << 32 | name) -> dir
+	LocalVector<uint32_t> dir_subdirs;
+	LocalVector<uint32_t> dir_files; // entry indices
+	bool dir_index_dirty = true;
+	// lowercase extension -> entries, in pack order
+	HashMap<String, LocalVector<uint32_t>> ext_index;
+	bool ext_index_dirty = true;
+	Mutex lazy_mutex;
 
 	Vector<PackSource *> sources;
 
-	PackedDir *root = nullptr;
-
 	static GDREPackedData *singleton;
 	bool disabled = false;
 	bool packed_data_was_enabled = false;
 
-	void _free_packed_dirs(PackedDir *p_dir);
+	uint32_t _intern(const String &p_str, LocalVector<String> &r_table, HashMap<String, uint32_t> &r_ids);
+	uint32_t _get_or_add_dir(uint32_t p_parent, const String &p_name);
+	uint32_t _find_subdir(uint32_t p_dir, const String &p_name) const;
+	bool _dir_has_file(uint32_t p_dir, const String &p_name) const;
+	void _update_dir_index();
+	void _update_ext_index();
+	void _get_subtree_entries(uint32_t p_dir, LocalVector<uint32_t> &r_indices) const;
+	String _get_entry_path(uint32_t p_idx) const;
+	PackedData::PackedFile _make_packed_file(uint32_t p_idx) const;
+	Ref<PackedFileInfo> _make_file_info(uint32_t p_idx) const;
+
 	void set_default_file_access();
 	void reset_default_file_access();
+	void _clear_index();
 	void _clear();
 
 public:
 	Vector<Ref<PackedFileInfo>> get_file_info_list(const Vector<String> &filters = Vector<String>());
+	// Records the result of a checksum check, so later listings of the file report it
+	void set_md5_match(const String &p_path, bool p_pass);
 
 	void add_pack_source(PackSource *p_source);
 	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_pck_src = false); // for PackSource
@@ -97,6 +149,8 @@ class FileAccessGDRE : public FileAccess {
 	static Ref<FileAccess> _open_filesystem(const String &p_path, int p_mode_flags, Error *r_error);
 
 public:
+	Ref<FileAccess> get_proxy() const { return proxy; }
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
@@ -123,13 +177,13 @@ public:
 };
 
 class DirAccessGDRE : public DirAccess {
-	GDREPackedData::PackedDir *current;
+	uint32_t current = GDREPackedData::INVALID_INDEX;
 
 	List<String> list_dirs;
 	List<String> list_files;
 	bool cdir = false;
 
-	GDREPackedData::PackedDir *_find_dir(String p_dir);
+	uint32_t _find_dir(String p_dir);
 
 	Ref<DirAccess> proxy;
 
@@ -0,0 +1,254 @@
+#include "file_access_mmap.h"
+
+#include "utility/file_access_gdre.h"
+
+#if defined(WINDOWS_ENABLED)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(UNIX_ENABLED)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Ref<MMappedFile> MMappedFile::open(const String &p_path, Error *r_error) {
+	Error err = ERR_UNAVAILABLE;
+	if (!r_error) {
+		r_error = &err;
+	}
+	*r_error = ERR_UNAVAILABLE;
+	// Only real filesystem paths can be mapped.
+	if (p_path.contains("://")) {
+		return Ref<MMappedFile>();
+	}
+	Ref<MMappedFile> mf;
+	mf.instantiate();
+	mf->path = p_path;
+#if defined(WINDOWS_ENABLED)
+	HANDLE file = CreateFileW((LPCWSTR)(p_path.utf16().get_data()), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		*r_error = ERR_FILE_CANT_OPEN;
+		return Ref<MMappedFile>();
+	}
+	mf->file_handle = file;
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+		*r_error = ERR_FILE_CANT_READ;
+		return Ref<MMappedFile>();
+	}
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		*r_error = ERR_OUT_OF_MEMORY;
+		return Ref<MMappedFile>();
+	}
+	mf->mapping_handle = mapping;
+	void *ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!ptr) {
+		*r_error = ERR_OUT_OF_MEMORY;
+		return Ref<MMappedFile>();
+	}
+	mf->data = (const uint8_t *)ptr;
+	mf->size = file_size.QuadPart;
+#elif defined(UNIX_ENABLED)
+	int fd = ::open(p_path.utf8().get_data(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		*r_error = ERR_FILE_CANT_OPEN;
+		return Ref<MMappedFile>();
+	}
+	mf->fd = fd;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0 || (uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+		*r_error = ERR_FILE_CANT_READ;
+		return Ref<MMappedFile>();
+	}
+	void *ptr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (ptr == MAP_FAILED) {
+		*r_error = ERR_OUT_OF_MEMORY;
+		return Ref<MMappedFile>();
+	}
+	mf->data = (const uint8_t *)ptr;
+	mf->size = st.st_size;
+#else
+	return Ref<MMappedFile>();
+#endif
+	*r_error = OK;
+	return mf;
+}
+
+int MMappedFile::get_fd() const {
+#if defined(WINDOWS_ENABLED)
+	return -1;
+#else
+	return fd;
+#endif
+}
+
+void MMappedFile::prefetch(uint64_t p_offset, uint64_t p_size) const {
+	if (!data || p_size == 0 || !contains(p_offset, p_size)) {
+		return;
+	}
+#if defined(UNIX_ENABLED)
+	// madvise() needs a page-aligned address
+	static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+	uint64_t start = p_offset - (p_offset % page_size);
+	madvise((void *)(data + start), (size_t)(p_size + (p_offset - start)), MADV_WILLNEED);
+#endif
+}
+
+void MMappedFile::_unmap() {
+#if defined(WINDOWS_ENABLED)
+	if (data) {
+		UnmapViewOfFile(data);
+	}
+	if (mapping_handle) {
+		CloseHandle((HANDLE)mapping_handle);
+	}
+	if (file_handle) {
+		CloseHandle((HANDLE)file_handle);
+	}
+	mapping_handle = nullptr;
+	file_handle = nullptr;
+#elif defined(UNIX_ENABLED)
+	if (data) {
+		munmap((void *)data, (size_t)size);
+	}
+	if (fd >= 0) {
+		::close(fd);
+	}
+	fd = -1;
+#endif
+	data = nullptr;
+	size = 0;
+}
+
+MMappedFile::~MMappedFile() {
+	_unmap();
+}
+
+Ref<FileAccessMMap> FileAccessMMap::create_slice(const Ref<MMappedFile> &p_mapping, const String &p_path, uint64_t p_offset, uint64_t p_size) {
+	ERR_FAIL_COND_V_MSG(p_mapping.is_null() || !p_mapping->is_valid(), Ref<FileAccessMMap>(), "Invalid mapping for " + p_path);
+	ERR_FAIL_COND_V_MSG(!p_mapping->contains(p_offset, p_size), Ref<FileAccessMMap>(), "File " + p_path + " extends past the end of " + p_mapping->get_path());
+	Ref<FileAccessMMap> fa;
+	fa.instantiate();
+	fa->mapping = p_mapping;
+	fa->path = p_path;
+	fa->data = p_mapping->get_data() + p_offset;
+	fa->offset = p_offset;
+	fa->length = p_size;
+	return fa;
+}
+
+Ref<FileAccessMMap> FileAccessMMap::get_mmap_access(const Ref<FileAccess> &p_file) {
+	Ref<FileAccessMMap> fa = p_file;
+	if (fa.is_valid()) {
+		return fa;
+	}
+	Ref<FileAccessGDRE> fag = p_file;
+	if (fag.is_valid()) {
+		return fag->get_proxy();
+	}
+	return Ref<FileAccessMMap>();
+}
+
+const uint8_t *FileAccessMMap::get_buffer_ptr(uint64_t p_length, uint64_t &r_read) const {
+	ERR_FAIL_COND_V_MSG(!data, nullptr, "File must be opened before use.");
+	r_read = MIN(p_length, length - pos);
+	if (r_read < p_length) {
+		eofed = true;
+	}
+	const uint8_t *ret = data + pos;
+	pos += r_read;
+	return ret;
+}
+
+Error FileAccessMMap::open_internal(const String &p_path, int p_mode_flags) {
+	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "FileAccessMMap can only be created from a mapping.");
+}
+
+bool FileAccessMMap::is_open() const {
+	return data != nullptr;
+}
+
+void FileAccessMMap::seek(uint64_t p_position) {
+	ERR_FAIL_COND_MSG(!data, "File must be opened before use.");
+	eofed = false;
+	if (p_position > length) {
+		eofed = true;
+		p_position = length;
+	}
+	pos = p_position;
+}
+
+void FileAccessMMap::seek_end(int64_t p_position) {
+	ERR_FAIL_COND_MSG(!data, "File must be opened before use.");
+	seek(length + p_position);
+}
+
+uint64_t FileAccessMMap::get_position() const {
+	ERR_FAIL_COND_V_MSG(!data, 0, "File must be opened before use.");
+	return pos;
+}
+
+uint64_t FileAccessMMap::get_length() const {
+	ERR_FAIL_COND_V_MSG(!data, 0, "File must be opened before use.");
+	return length;
+}
+
+bool FileAccessMMap::eof_reached() const {
+	return eofed;
+}
+
+uint8_t FileAccessMMap::get_8() const {
+	ERR_FAIL_COND_V_MSG(!data, 0, "File must be opened before use.");
+	if (pos >= length) {
+		eofed = true;
+		return 0;
+	}
+	return data[pos++];
+}
+
+uint64_t FileAccessMMap::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+	uint64_t read = 0;
+	const uint8_t *src = get_buffer_ptr(p_length, read);
+	ERR_FAIL_COND_V(!src, -1);
+	memcpy(p_dst, src, read);
+	return read;
+}
+
+Error FileAccessMMap::get_error() const {
+	if (!data) {
+		return ERR_UNCONFIGURED;
+	}
+	return eofed ? ERR_FILE_EOF : OK;
+}
+
+void FileAccessMMap::flush() {
+	ERR_FAIL();
+}
+
+bool FileAccessMMap::store_8(uint8_t p_dest) {
+	ERR_FAIL_V(false);
+}
+
+bool FileAccessMMap::store_buffer(const uint8_t *p_src, uint64_t p_length) {
+	ERR_FAIL_V(false);
+}
+
+bool FileAccessMMap::file_exists(const String &p_name) {
+	return false;
+}
+
+void FileAccessMMap::close() {
+	mapping = Ref<MMappedFile>();
+	data = nullptr;
+	length = 0;
+	pos = 0;
+}
+
+FileAccessMMap::~FileAccessMMap() {
+	close();
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "core/io/file_access.h"
+#include "core/object/ref_counted.h"
+
+// A read-only mapping of an entire file.
+// This is shared between every FileAccessMMap slice opened on it, and is unmapped when the last reference is dropped.
+class MMappedFile : public RefCounted {
+	GDCLASS(MMappedFile, RefCounted);
+
+	String path;
+	const uint8_t *data = nullptr;
+	uint64_t size = 0;
+#ifdef WINDOWS_ENABLED
+	void *file_handle = nullptr;
+	void *mapping_handle = nullptr;
+#else
+	int fd = -1;
+#endif
+
+	void _unmap();
+
+public:
+	static Ref<MMappedFile> open(const String &p_path, Error *r_error = nullptr);
+
+	String get_path() const { return path; }
+	const uint8_t *get_data() const { return data; }
+	uint64_t get_size() const { return size; }
+	bool is_valid() const { return data != nullptr; }
+	bool contains(uint64_t p_offset, uint64_t p_size) const { return p_offset <= size && p_size <= size - p_offset; }
+	// The OS file descriptor backing the mapping, or -1 if there is none.
+	int get_fd() const;
+	// Hint that the given range is about to be read, so the OS can read it in ahead of time in one go.
+	void prefetch(uint64_t p_offset, uint64_t p_size) const;
+
+	MMappedFile() {}
+	~MMappedFile();
+};
+
+// A read-only FileAccess over a slice of an MMappedFile.
+// Reads are a memcpy out of the mapping; callers that only need to look at the bytes can use get_data_ptr() and skip the copy entirely.
+class FileAccessMMap : public FileAccess {
+	GDCLASS(FileAccessMMap, FileAccess);
+
+	Ref<MMappedFile> mapping;
+	String path;
+	const uint8_t *data = nullptr;
+	uint64_t offset = 0;
+	uint64_t length = 0;
+	mutable uint64_t pos = 0;
+	mutable bool eofed = false;
+
+public:
+	static Ref<FileAccessMMap> create_slice(const Ref<MMappedFile> &p_mapping, const String &p_path, uint64_t p_offset, uint64_t p_size);
+	// Returns the FileAccessMMap backing p_file (looking through FileAccessGDRE), or an invalid ref if it isn't memory mapped.
+	static Ref<FileAccessMMap> get_mmap_access(const Ref<FileAccess> &p_file);
+
+	Ref<MMappedFile> get_mapping() const { return mapping; }
+	// Offset of this slice in the mapped file.
+	uint64_t get_mapping_offset() const { return offset; }
+	// Pointer to the start of the slice; valid for as long as this object (or the mapping) is alive.
+	const uint8_t *get_data_ptr() const { return data; }
+	// Returns a pointer to the bytes at the current position and advances the position, like get_buffer() without the copy.
+	const uint8_t *get_buffer_ptr(uint64_t p_length, uint64_t &r_read) const;
+
+	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
+	virtual bool is_open() const override; ///< true when file is open
+
+	virtual String get_path() const override { return path; }
+	virtual String get_path_absolute() const override { return path; }
+
+	virtual void seek(uint64_t p_position) override; ///< seek to a given position
+	virtual void seek_end(int64_t p_position = 0) override; ///< seek from the end of file
+	virtual uint64_t get_position() const override; ///< get position in the file
+	virtual uint64_t get_length() const override; ///< get size of the file
+
+	virtual bool eof_reached() const override; ///< reading passed EOF
+
+	virtual uint8_t get_8() const override; ///< get a byte
+	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+
+	virtual Error get_error() const override; ///< get last error
+
+	virtual Error resize(int64_t p_length) override { return ERR_UNAVAILABLE; }
+	virtual void flush() override;
+	virtual bool store_8(uint8_t p_dest) override; ///< store a byte
+	virtual bool store_buffer(const uint8_t *p_src, uint64_t p_length) override; ///< store an array of bytes
+
+	virtual bool file_exists(const String &p_name) override; ///< return true if a file exists
+
+	virtual void close() override;
+
+	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
+	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
+	virtual Error _set_unix_permissions(const String &p_file, BitField<FileAccess::UnixPermissionFlags> p_permissions) override { return FAILED; }
+
+	virtual bool _get_hidden_attribute(const String &p_file) override { return false; }
+	virtual Error _set_hidden_attribute(const String &p_file, bool p_hidden) override { return ERR_UNAVAILABLE; }
+	virtual bool _get_read_only_attribute(const String &p_file) override { return true; }
+	virtual Error _set_read_only_attribute(const String &p_file, bool p_ro) override { return ERR_UNAVAILABLE; }
+
+	FileAccessMMap() {}
+	~FileAccessMMap();
+};
@@ -1,6 +1,7 @@
 #include "gdre_packed_source.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/object/script_language.h"
+#include "file_access_encrypted_stream.h"
 #include "file_access_gdre.h"
 #include "gdre_settings.h"
 
@@ -350,8 +351,60 @@ bool GDREPackedSource::try_open_pack(const String &p_path, bool p_replace_files,
 		GDREPackedData::get_singleton()->add_path(pck_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), true);
 	}
 
+	_map_pack(pck_path);
+
 	return true;
 }
+
+void GDREPackedSource::_map_pack(const String &p_path) {
+	if (mappings.has(p_path)) {
+		return;
+	}
+	Error err = OK;
+	Ref<MMappedFile> mapping = MMappedFile::open(p_path, &err);
+	if (mapping.is_null()) {
+		// Not fatal, we just fall back to FileAccessPack.
+		print_verbose("Could not memory map " + p_path + " (error " + itos(err) + "), falling back to buffered reads.");
+		return;
+	}
+	mappings[p_path] = mapping;
+}
+
+Ref<MMappedFile> GDREPackedSource::get_pack_mapping(const String &p_pack_path) const {
+	const Ref<MMappedFile> *mapping = mappings.getptr(p_pack_path);
+	return mapping ? *mapping : Ref<MMappedFile>();
+}
+
 Ref<FileAccess> GDREPackedSource::get_file(const String &p_path, PackedData::PackedFile *p_file) {
-	return memnew(FileAccessPack(p_path, *p_file));
+	Ref<MMappedFile> mapping = get_pack_mapping(p_file->pack);
+	if (mapping.is_null() || !mapping->contains(p_file->offset, p_file->size)) {
+		return memnew(FileAccessPack(p_path, *p_file));
+	}
+	Ref<FileAccess> f = FileAccessMMap::create_slice(mapping, p_path, p_file->offset, p_file->size);
+	ERR_FAIL_COND_V_MSG(f.is_null(), Ref<FileAccess>(), "Can't open pack-referenced file '" + p_path + "'.");
+	if (p_file->encrypted) {
+		Vector<uint8_t> key;
+		key.resize(32);
+		for (int i = 0; i < key.size(); i++) {
+			key.write[i] = script_encryption_key[i];
+		}
+
+		// Large entries are decrypted as they're read instead of all at once on open; the MD5 mismatch for a bad key then shows up in get_error()
+		if (p_file->size >= FileAccessEncryptedStream::STREAMING_MIN_SIZE) {
+			Ref<FileAccessEncryptedStream> faes;
+			faes.instantiate();
+			Error err = faes->open_and_parse(f, key, false);
+			ERR_FAIL_COND_V_MSG(err, Ref<FileAccess>(), "Can't open encrypted pack-referenced file '" + String(p_file->pack) + "'.");
+			return faes;
+		}
+
+		Ref<FileAccessEncrypted> fae;
+		fae.instantiate();
+		ERR_FAIL_COND_V_MSG(fae.is_null(), Ref<FileAccess>(), "Can't open encrypted pack-referenced file '" + String(p_file->pack) + "'.");
+
+		Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
+		ERR_FAIL_COND_V_MSG(err, Ref<FileAccess>(), "Can't open encrypted pack-referenced file '" + String(p_file->pack) + "'.");
+		f = fae;
+	}
+	return f;
 }
\ No newline at end of file
@@ -1,9 +1,17 @@
 #pragma once
 
 #include "core/io/file_access_pack.h"
+#include "utility/file_access_mmap.h"
 
 class GDREPackedSource : public PackSource {
+	// One shared read-only mapping per pack; every entry is opened as a slice of it.
+	HashMap<String, Ref<MMappedFile>> mappings;
+
+	void _map_pack(const String &p_path);
+
 public:
+	Ref<MMappedFile> get_pack_mapping(const String &p_pack_path) const;
+
 	static bool is_embeddable_executable(const String &p_path);
 	static bool has_embedded_pck(const String &p_path);
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset);
@@ -5,7 +5,9 @@
 #include "compat/resource_compat_binary.h"
 #include "compat/resource_loader_compat.h"
 #include "core/error/error_list.h"
+#include "core/crypto/crypto_core.h"
 #include "core/error/error_macros.h"
+#include "core/io/config_file.h"
 #include "core/io/file_access.h"
 #include "core/object/class_db.h"
 #include "core/object/worker_thread_pool.h"
@@ -575,19 +577,25 @@ Error GDRESettings::load_project(const Vector<String> &p_paths, bool _cmd_line_e
 		return OK;
 	}
 
-	if (!has_valid_version()) {
-		// We need to get the version from the binary resources.
-		err = get_version_from_bin_resources();
-		// this is a catastrophic failure, unload the pack
-		if (err) {
-			unload_project();
-			ERR_FAIL_V_MSG(err, "FATAL ERROR: Can't determine engine version of project pack!");
+	bool cache_hit = pack_index_cache_enabled && _load_pack_index_cache();
+	bool revision_detected = cache_hit;
+	if (!cache_hit) {
+		if (!has_valid_version()) {
+			// We need to get the version from the binary resources.
+			err = get_version_from_bin_resources();
+			// this is a catastrophic failure, unload the pack
+			if (err) {
+				unload_project();
+				ERR_FAIL_V_MSG(err, "FATAL ERROR: Can't determine engine version of project pack!");
+			}
 		}
-	}
 
-	err = detect_bytecode_revision();
-	if (err) {
-		WARN_PRINT("Could not determine bytecode revision, not able to decompile scripts...");
+		err = detect_bytecode_revision();
+		if (err) {
+			WARN_PRINT("Could not determine bytecode revision, not able to decompile scripts...");
+		} else {
+			revision_detected = true;
+		}
 	}
 
 	if (!pack_has_project_config()) {
@@ -597,8 +605,13 @@ Error GDRESettings::load_project(const Vector<String> &p_paths, bool _cmd_line_e
 		ERR_FAIL_COND_V_MSG(err, err, "FATAL ERROR: Can't open project config!");
 	}
 
-	err = load_import_files();
-	ERR_FAIL_COND_V_MSG(err, ERR_FILE_CANT_READ, "FATAL ERROR: Could not load imported binary files!");
+	if (!cache_hit) {
+		err = load_import_files();
+		ERR_FAIL_COND_V_MSG(err, ERR_FILE_CANT_READ, "FATAL ERROR: Could not load imported binary files!");
+		if (pack_index_cache_enabled && revision_detected) {
+			_save_pack_index_cache();
+		}
+	}
 
 	return OK;
 }
@@ -686,6 +699,131 @@ int GDRESettings::get_bytecode_revision() const {
 	return is_pack_loaded() ? current_project->bytecode_revision : 0;
 }
 
+void GDRESettings::set_pack_index_cache_enabled(bool p_enabled) {
+	pack_index_cache_enabled = p_enabled;
+}
+
+bool GDRESettings::is_pack_index_cache_enabled() const {
+	return pack_index_cache_enabled;
+}
+
+// Bump this if the contents of the cache change
+static constexpr int PACK_INDEX_CACHE_VERSION = 3;
+// How much of the start of each pack is hashed to tell it apart from another file with the same size and mtime
+static constexpr int64_t PACK_INDEX_HEADER_HASH_SIZE = 64 * 1024;
+
+String GDRESettings::_get_pack_index_cache_path() const {
+	String key;
+	for (const auto &pack : packs) {
+		key += pack->pack_file + "\n";
+	}
+	return OS::get_singleton()->get_cache_path().path_join("gdre_pack_index").path_join(key.md5_text() + ".cfg");
+}
+
+// Identifies the currently loaded packs (their paths, sizes, modification times and a hash of their headers) and the encryption key.
+// The bytecode revision is detected by decrypting scripts, so a cache entry made with one key must not be reused with another.
+Dictionary GDRESettings::_get_pack_index_cache_key() const {
+	Dictionary key;
+	key["cache_version"] = PACK_INDEX_CACHE_VERSION;
+	key["gdre_version"] = get_gdre_version();
+	unsigned char key_hash[16];
+	CryptoCore::md5(enc_key.ptr(), enc_key.size(), key_hash);
+	key["encryption_key_md5"] = String::hex_encode_buffer(key_hash, 16);
+	Array pack_keys;
+	for (const auto &pack : packs) {
+		Ref<FileAccess> f = FileAccess::open(pack->pack_file, FileAccess::READ);
+		if (f.is_null()) {
+			return Dictionary();
+		}
+		Vector<uint8_t> header;
+		header.resize(MIN(PACK_INDEX_HEADER_HASH_SIZE, (int64_t)f->get_length()));
+		f->get_buffer(header.ptrw(), header.size());
+		unsigned char hash[16];
+		CryptoCore::md5(header.ptr(), header.size(), hash);
+		Dictionary pack_key;
+		pack_key["path"] = pack->pack_file;
+		pack_key["size"] = f->get_length();
+		pack_key["mtime"] = FileAccess::get_modified_time(pack->pack_file);
+		pack_key["header_md5"] = String::hex_encode_buffer(hash, 16);
+		pack_keys.push_back(pack_key);
+	}
+	key["packs"] = pack_keys;
+	return key;
+}
+
+bool GDRESettings::_load_pack_index_cache() {
+	if (packs.is_empty() || get_pack_type() == PackInfo::DIR) {
+		return false;
+	}
+	String cache_path = _get_pack_index_cache_path();
+	if (!FileAccess::exists(cache_path)) {
+		return false;
+	}
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	if (cf->load(cache_path) != OK) {
+		return false;
+	}
+	Dictionary key = _get_pack_index_cache_key();
+	if (key.is_empty() || cf->get_value("cache", "key", Dictionary()) != Variant(key)) {
+		print_verbose("Pack index cache is stale, ignoring " + cache_path);
+		return false;
+	}
+	Ref<GodotVer> version = GodotVer::parse(cf->get_value("project", "version", ""));
+	int revision = cf->get_value("project", "bytecode_revision", 0);
+	if (version.is_null() || !version->is_valid_semver()) {
+		return false;
+	}
+	// Rebuild everything before touching the project, so a bad entry falls back to a full load
+	Array cached_imports = cf->get_value("imports", "import_files", Array());
+	Array loaded_imports;
+	loaded_imports.resize(cached_imports.size());
+	for (int i = 0; i < cached_imports.size(); i++) {
+		Ref<ImportInfo> iinfo = ImportInfo::deserialize(cached_imports[i]);
+		if (iinfo.is_null()) {
+			print_verbose("Pack index cache has an invalid import entry, ignoring " + cache_path);
+			return false;
+		}
+		loaded_imports[i] = iinfo;
+	}
+	current_project->version = version;
+	current_project->bytecode_revision = revision;
+	for (int i = 0; i < loaded_imports.size(); i++) {
+		Ref<ImportInfo> iinfo = loaded_imports[i];
+		if (iinfo->get_iitype() == ImportInfo::REMAP) {
+			remap_iinfo.insert(iinfo->get_import_md_path(), iinfo);
+		}
+		import_files.push_back(iinfo);
+	}
+	print_line("Loaded engine version " + version->as_text() + ", bytecode revision " + String::num_int64(revision, 16) + " and " + itos(loaded_imports.size()) + " import files from pack index cache");
+	return true;
+}
+
+Error GDRESettings::_save_pack_index_cache() {
+	if (packs.is_empty() || get_pack_type() == PackInfo::DIR || !has_valid_version()) {
+		return ERR_UNAVAILABLE;
+	}
+	Dictionary key = _get_pack_index_cache_key();
+	ERR_FAIL_COND_V(key.is_empty(), ERR_FILE_CANT_OPEN);
+	String cache_path = _get_pack_index_cache_path();
+	Error err = gdre::ensure_dir(cache_path.get_base_dir());
+	ERR_FAIL_COND_V_MSG(err, err, "Can't create pack index cache directory " + cache_path.get_base_dir());
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	cf->set_value("cache", "key", key);
+	cf->set_value("project", "version", current_project->version->as_text());
+	cf->set_value("project", "bytecode_revision", current_project->bytecode_revision);
+	Array cached_imports;
+	cached_imports.resize(import_files.size());
+	for (int i = 0; i < import_files.size(); i++) {
+		cached_imports[i] = ImportInfo::serialize(import_files[i]);
+	}
+	cf->set_value("imports", "import_files", cached_imports);
+	err = cf->save(cache_path);
+	ERR_FAIL_COND_V_MSG(err, err, "Can't write pack index cache " + cache_path);
+	return OK;
+}
+
 Error GDRESettings::get_version_from_bin_resources() {
 	int consistent_versions = 0;
 	int inconsistent_versions = 0;
@@ -738,9 +876,10 @@ Error GDRESettings::get_version_from_bin_resources() {
 	};
 
 	if (!bytecode_files.is_empty()) {
-		decomps = BytecodeTester::get_possible_decomps(bytecode_files);
+		auto bytecode_set = BytecodeTester::load_bytecode_set(bytecode_files);
+		decomps = BytecodeTester::get_possible_decomps(bytecode_set);
 		if (decomps.is_empty()) {
-			decomps = BytecodeTester::get_possible_decomps(bytecode_files, true);
+			decomps = BytecodeTester::get_possible_decomps(bytecode_set, true);
 		}
 		ERR_FAIL_COND_V_MSG(decomps.is_empty(), ERR_FILE_NOT_FOUND, "Cannot determine version from bin resources: decomp testing failed!");
 		if (do_thing()) {
@@ -1765,6 +1904,8 @@ void GDRESettings::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack_has_project_config"), &GDRESettings::pack_has_project_config);
 	ClassDB::bind_method(D_METHOD("get_gdre_version"), &GDRESettings::get_gdre_version);
 	ClassDB::bind_method(D_METHOD("get_disclaimer_text"), &GDRESettings::get_disclaimer_text);
+	ClassDB::bind_method(D_METHOD("set_pack_index_cache_enabled", "enabled"), &GDRESettings::set_pack_index_cache_enabled);
+	ClassDB::bind_method(D_METHOD("is_pack_index_cache_enabled"), &GDRESettings::is_pack_index_cache_enabled);
 	// ClassDB::bind_method(D_METHOD("get_auto_display_scale"), &GDRESettings::get_auto_display_scale);
 	// TODO: route this through GDRE Settings rather than GDRE Editor
 	//ADD_SIGNAL(MethodInfo("write_log_message", PropertyInfo(Variant::STRING, "message")));
@@ -133,6 +133,7 @@ private:
 	static GDRESettings *singleton;
 	static String exec_dir;
 	bool headless = false;
+	bool pack_index_cache_enabled = false;
 	void remove_current_pack();
 	String _get_res_path(const String &p_path, const String &resource_dir, const bool suppress_errors);
 	void add_logger();
@@ -150,6 +151,10 @@ private:
 	Error load_pack_uid_cache(bool p_reset = false);
 	Error reset_uid_cache();
 	Error detect_bytecode_revision();
+	String _get_pack_index_cache_path() const;
+	Dictionary _get_pack_index_cache_key() const;
+	bool _load_pack_index_cache();
+	Error _save_pack_index_cache();
 
 	static constexpr bool need_correct_patch(int ver_major, int ver_minor);
 
@@ -229,6 +234,12 @@ public:
 	void load_all_resource_strings();
 	void get_resource_strings(HashSet<String> &r_strings) const;
 	int get_bytecode_revision() const;
+	// Caches the detected engine version, bytecode revision and import info table of loaded packs, so re-opening the same
+	// packs skips detection and reading every .import/.remap file. The pack directory itself is still read from the pack.
+	// Entries are keyed on the encryption key too. Nothing is cached when the bytecode revision can't be detected,
+	// so those packs (e.g. encrypted scripts opened with the wrong key) go through full detection on every load.
+	void set_pack_index_cache_enabled(bool p_enabled);
+	bool is_pack_index_cache_enabled() const;
 	static GDRESettings *get_singleton();
 	GDRESettings();
 	~GDRESettings();
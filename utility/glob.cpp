@@ -391,8 +391,75 @@ Vector<String> Glob::_glob(const String &inpath, bool recursive,
 	return result;
 }
 
+bool Glob::CompiledPattern::matches(const String &name) const {
+	if (regex.is_valid()) {
+		return regex->search(name).is_valid();
+	}
+	// The translated regex treats line breaks specially; no real path has them, so just defer to it.
+	if (name.contains_char('\n') || name.contains_char('\r')) {
+		return RegEx::create_from_string(translate(pattern))->search(name).is_valid();
+	}
+	// The regex is only anchored at the end, so the first part may start anywhere in the name.
+	const String &last = parts[parts.size() - 1];
+	if (parts.size() == 1) {
+		return name.ends_with(last);
+	}
+	int limit = name.length();
+	if (!last.is_empty()) {
+		if (!name.ends_with(last)) {
+			return false;
+		}
+		limit -= last.length();
+	}
+	// Taking the leftmost match of each part leaves the most room for the rest of them.
+	int pos = 0;
+	for (int i = 0; i < parts.size() - 1; i++) {
+		const String &part = parts[i];
+		if (part.is_empty()) {
+			continue;
+		}
+		int idx = name.find(part, pos);
+		if (idx == -1 || idx + part.length() > limit) {
+			return false;
+		}
+		pos = idx + part.length();
+	}
+	return true;
+}
+
+Mutex Glob::pattern_cache_mutex;
+HashMap<String, Glob::CompiledPattern> Glob::pattern_cache;
+
+Glob::CompiledPattern Glob::compile(const String &pattern) {
+	{
+		MutexLock lock(pattern_cache_mutex);
+		auto *cached = pattern_cache.getptr(pattern);
+		if (cached) {
+			return *cached;
+		}
+	}
+	CompiledPattern compiled;
+	compiled.pattern = pattern;
+	if (pattern.contains_char('?') || pattern.contains_char('[')) {
+		compiled.regex = RegEx::create_from_string(translate(pattern));
+	} else {
+		compiled.parts = pattern.split("*");
+	}
+	MutexLock lock(pattern_cache_mutex);
+	if (pattern_cache.size() >= MAX_CACHED_PATTERNS) {
+		pattern_cache.clear();
+	}
+	pattern_cache.insert(pattern, compiled);
+	return compiled;
+}
+
+void Glob::clear_pattern_cache() {
+	MutexLock lock(pattern_cache_mutex);
+	pattern_cache.clear();
+}
+
 bool Glob::fnmatch(const String &name, const String &pattern) {
-	return RegEx::create_from_string(translate(pattern))->search(name).is_valid();
+	return compile(pattern).matches(name);
 }
 
 Vector<String> Glob::fnmatch_list(const Vector<String> &names, const Vector<String> &patterns) {
@@ -400,14 +467,13 @@ Vector<String> Glob::fnmatch_list(const Vector<String> &names, const Vector<Stri
 	if (patterns.is_empty() || names.is_empty()) {
 		return result;
 	}
-	Vector<Ref<RegEx>> regexes;
+	Vector<CompiledPattern> compiled;
 	for (auto &pattern : patterns) {
-		auto re = RegEx::create_from_string(translate(pattern));
-		regexes.push_back(re);
+		compiled.push_back(compile(pattern));
 	}
 	for (auto &n : names) {
-		for (auto &re : regexes) {
-			if (re->search(n).is_valid()) {
+		for (auto &cp : compiled) {
+			if (cp.matches(n)) {
 				result.push_back(n);
 				break;
 			}
@@ -421,15 +487,14 @@ Vector<String> Glob::pattern_match_list(const Vector<String> &names, const Vecto
 	if (patterns.is_empty() || names.is_empty()) {
 		return result;
 	}
-	Vector<Ref<RegEx>> regexes;
+	Vector<CompiledPattern> compiled;
 	for (auto &pattern : patterns) {
-		auto re = RegEx::create_from_string(translate(pattern));
-		regexes.push_back(re);
+		compiled.push_back(compile(pattern));
 	}
-	for (int i = 0; i < regexes.size(); i++) {
-		auto &re = regexes[i];
+	for (int i = 0; i < compiled.size(); i++) {
+		auto &cp = compiled[i];
 		for (auto &n : names) {
-			if (re->search(n).is_valid()) {
+			if (cp.matches(n)) {
 				result.push_back(patterns[i]);
 				break;
 			}
@@ -25,7 +25,9 @@
 
 #pragma once
 #include "core/object/object.h"
+#include "core/os/mutex.h"
 #include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/vector.h"
 #include "modules/regex/regex.h"
 
@@ -41,6 +43,24 @@ protected:
 	static Ref<RegEx> escapere;
 	static constexpr const char *escape_pattern = R"([&~|])";
 
+	// A pattern ready to be matched against names.
+	// Patterns that only use '*' wildcards (e.g. "*.gd", "res://addons/foo/*", literal paths) are matched by hand;
+	// anything with '?' or a character class goes through the regex built by translate().
+	struct CompiledPattern {
+		// The pattern split on '*'; only used if `regex` is null
+		Vector<String> parts;
+		Ref<RegEx> regex;
+		String pattern;
+
+		bool matches(const String &name) const;
+	};
+	static constexpr int MAX_CACHED_PATTERNS = 1024;
+	static Mutex pattern_cache_mutex;
+	static HashMap<String, CompiledPattern> pattern_cache;
+
+	static CompiledPattern compile(const String &pattern);
+	static void clear_pattern_cache();
+
 	static String translate(const String &pattern);
 	static bool has_magic(const String &pathname);
 	static Vector<String> _glob(const String &inpath, bool recursive = false,
@@ -8,6 +8,7 @@
 #include "core/error/error_list.h"
 #include "core/error/error_macros.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "exporters/export_report.h"
 #include "exporters/oggstr_exporter.h"
@@ -434,46 +435,70 @@ Error ImportExporter::decompile_scripts(const String &p_out_dir, const Vector<St
 	}
 
 	print_line("Script version " + decomp->get_engine_version() + " (rev 0x" + String::num_int64(decomp->get_bytecode_rev(), 16) + ") detected");
-	Error err;
+
+	Vector<DecompileToken> tokens;
+	tokens.resize(code_files.size());
 	for (int i = 0; i < code_files.size(); i++) {
-		const String &f = code_files[i];
-		String dest_file = f.replace(".gdc", ".gd").replace(".gde", ".gd");
-		Ref<DirAccess> da = DirAccess::open(p_out_dir);
-		print_verbose("decompiling " + f);
-		bool encrypted = false;
-		if (f.get_extension().to_lower() == "gde") {
-			encrypted = true;
-			err = decomp->decompile_byte_code_encrypted(f, get_settings()->get_encryption_key());
-		} else {
-			err = decomp->decompile_byte_code(f);
+		tokens.write[i].path = code_files[i];
+		tokens.write[i].encrypted = code_files[i].get_extension().to_lower() == "gde";
+	}
+	script_key = get_settings()->get_encryption_key();
+	script_encryption_failed_idx = INT_MAX;
+	worker_decomps.clear();
+	if (opt_multi_thread && tokens.size() > 1) {
+		int thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+		worker_decomps.resize(thread_count + 1);
+		for (int i = 0; i < thread_count; i++) {
+			worker_decomps.write[i] = GDScriptDecomp::create_decomp_for_commit(revision);
 		}
-		if (err) {
-			String err_string = decomp->get_error_message();
+		worker_decomps.write[thread_count] = decomp;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
+				this,
+				&ImportExporter::_do_decompile,
+				tokens.ptrw(),
+				tokens.size(), -1, true, SNAME("ImportExporter::decompile_scripts"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		worker_decomps.push_back(decomp);
+		for (int i = 0; i < tokens.size(); i++) {
+			_do_decompile(i, tokens.ptrw());
+		}
+	}
+	worker_decomps.clear();
+	script_key.clear();
+
+	// Write everything out in order, stopping at the first encrypted script we couldn't decompile as before
+	Ref<DirAccess> da = DirAccess::open(p_out_dir);
+	for (int i = 0; i < tokens.size(); i++) {
+		DecompileToken &token = tokens.write[i];
+		const String &f = token.path;
+		String dest_file = f.replace(".gdc", ".gd").replace(".gde", ".gd");
+		if (token.err) {
 			// TODO: make it not fail hard on the first script that fails to decompile
-			if (encrypted) {
+			if (token.encrypted) {
 				add_to_failed(i);
 				report->had_encryption_error = true;
-				ERR_FAIL_V_MSG(err, "error decompiling encrypted script " + f + ": " + err_string);
+				ERR_FAIL_V_MSG(token.err, "error decompiling encrypted script " + f + ": " + token.err_string);
 			} else {
 				report->failed_scripts.push_back(f);
-				WARN_PRINT("error decompiling " + f + ": " + err_string);
+				WARN_PRINT("error decompiling " + f + ": " + token.err_string);
 			}
 		} else {
-			String text = decomp->get_script_text();
 			String out_path = p_out_dir.path_join(dest_file.replace("res://", ""));
 			Ref<FileAccess> fa = FileAccess::open(out_path, FileAccess::WRITE);
 			if (fa.is_null()) {
 				report->failed_scripts.push_back(f);
 				continue;
 			}
-			fa->store_string(text);
+			fa->store_string(token.text);
+			token.text = String();
 			if (has_remaps && get_settings()->has_remap(dest_file, f)) {
 				remove_remap_and_autoconverted(dest_file, f, p_out_dir);
 			} else {
 				handle_auto_converted_file(f, p_out_dir);
 			}
 			// TODO: make "remove_remap" do this instead
-			if (da->file_exists(f.replace(".gdc", ".gd.remap").replace("res://", ""))) {
+			if (da.is_valid() && da->file_exists(f.replace(".gdc", ".gd.remap").replace("res://", ""))) {
 				da->remove(f.replace(".gdc", ".gd.remap").replace("res://", ""));
 			}
 			print_verbose("successfully decompiled " + f);
@@ -483,6 +508,33 @@ Error ImportExporter::decompile_scripts(const String &p_out_dir, const Vector<St
 	return OK;
 }
 
+void ImportExporter::_do_decompile(uint32_t i, DecompileToken *tokens) {
+	DecompileToken &token = tokens[i];
+	if ((int)i > script_encryption_failed_idx) {
+		// We're going to stop at an earlier script anyway
+		token.err = ERR_SKIP;
+		return;
+	}
+	int thread_idx = WorkerThreadPool::get_singleton()->get_thread_index();
+	const Ref<GDScriptDecomp> &decomp = worker_decomps[thread_idx >= 0 && thread_idx < worker_decomps.size() - 1 ? thread_idx : worker_decomps.size() - 1];
+	print_verbose("decompiling " + token.path);
+	if (token.encrypted) {
+		token.err = decomp->decompile_byte_code_encrypted(token.path, script_key);
+	} else {
+		token.err = decomp->decompile_byte_code(token.path);
+	}
+	if (token.err) {
+		token.err_string = decomp->get_error_message();
+		if (token.encrypted) {
+			int failed_idx = script_encryption_failed_idx;
+			while ((int)i < failed_idx && !script_encryption_failed_idx.compare_exchange_weak(failed_idx, i)) {
+			}
+		}
+	} else {
+		token.text = decomp->get_script_text();
+	}
+}
+
 Error ImportExporter::recreate_plugin_config(const String &output_dir, const String &plugin_dir) {
 	Error err;
 	static const Vector<String> wildcards = { "*.gd" };
@@ -1,6 +1,7 @@
 #ifndef IMPORT_EXPORTER_H
 #define IMPORT_EXPORTER_H
 
+#include "bytecode/bytecode_base.h"
 #include "compat/resource_import_metadatav2.h"
 #include "exporters/export_report.h"
 #include "import_info.h"
@@ -111,8 +112,22 @@ class ImportExporter : public RefCounted {
 		bool opt_write_md5_files;
 	};
 
+	struct DecompileToken {
+		String path;
+		bool encrypted = false;
+		Error err = OK;
+		String text;
+		String err_string;
+	};
+	// One decompiler per worker thread (plus one for the calling thread), so they don't share decompile state
+	Vector<Ref<GDScriptDecomp>> worker_decomps;
+	Vector<uint8_t> script_key;
+	// Index of the first encrypted script that failed to decompile; nothing after it needs decompiling
+	std::atomic<int> script_encryption_failed_idx = INT_MAX;
+
 	Ref<ImportExporterReport> report;
 	void _do_export(uint32_t i, ExportToken *tokens);
+	void _do_decompile(uint32_t i, DecompileToken *tokens);
 	Error handle_auto_converted_file(const String &autoconverted_file, const String &output_dir);
 	Error rewrite_import_source(const String &rel_dest_path, const String &output_dir, const Ref<ImportInfo> &iinfo);
 	static Vector<String> get_v2_wildcards();
@@ -180,6 +180,114 @@ Ref<ImportInfo> ImportInfo::copy(const Ref<ImportInfo> &p_iinfo) {
 	return r_iinfo;
 }
 
+Dictionary ImportInfo::serialize(const Ref<ImportInfo> &p_iinfo) {
+	Dictionary d;
+	d["iitype"] = (int)p_iinfo->iitype;
+	d["import_md_path"] = p_iinfo->import_md_path;
+	d["ver_major"] = p_iinfo->ver_major;
+	d["ver_minor"] = p_iinfo->ver_minor;
+	d["format_ver"] = p_iinfo->format_ver;
+	d["not_an_import"] = p_iinfo->not_an_import;
+	d["auto_converted_export"] = p_iinfo->auto_converted_export;
+	d["dirty"] = p_iinfo->dirty;
+	d["preferred_import_path"] = p_iinfo->preferred_import_path;
+	d["export_dest"] = p_iinfo->export_dest;
+	d["export_lossless_copy"] = p_iinfo->export_lossless_copy;
+	switch (p_iinfo->iitype) {
+		case IInfoType::MODERN: {
+			Ref<ImportInfoModern> iinfo = p_iinfo;
+			d["src_md5"] = iinfo->src_md5;
+			d["cf"] = iinfo->cf->encode_to_text();
+		} break;
+		case IInfoType::V2: {
+			Ref<ImportInfov2> iinfo = p_iinfo;
+			d["type"] = iinfo->type;
+			d["dest_files"] = iinfo->dest_files;
+			d["editor"] = iinfo->v2metadata->get_editor();
+			Array sources;
+			for (int i = 0; i < iinfo->v2metadata->get_source_count(); i++) {
+				sources.push_back(iinfo->v2metadata->get_source_path(i));
+				sources.push_back(iinfo->v2metadata->get_source_md5(i));
+			}
+			d["sources"] = sources;
+			d["options"] = iinfo->v2metadata->get_options_as_dictionary();
+		} break;
+		case IInfoType::DUMMY:
+		case IInfoType::REMAP: {
+			Ref<ImportInfoDummy> iinfo = p_iinfo;
+			d["type"] = iinfo->type;
+			d["source_file"] = iinfo->source_file;
+			d["src_md5"] = iinfo->src_md5;
+			d["dest_files"] = iinfo->dest_files;
+			if (p_iinfo->iitype == IInfoType::REMAP) {
+				d["importer"] = ((Ref<ImportInfoRemap>)p_iinfo)->importer;
+			}
+		} break;
+		default:
+			break;
+	}
+	return d;
+}
+
+// Rebuilds an ImportInfo saved with serialize() without touching the files it was loaded from
+Ref<ImportInfo> ImportInfo::deserialize(const Dictionary &p_dict) {
+	Ref<ImportInfo> r_iinfo;
+	switch ((int)p_dict.get("iitype", (int)IInfoType::BASE)) {
+		case IInfoType::MODERN: {
+			Ref<ImportInfoModern> iinfo = memnew(ImportInfoModern);
+			iinfo->src_md5 = p_dict.get("src_md5", "");
+			Error err = iinfo->cf->parse(p_dict.get("cf", ""));
+			ERR_FAIL_COND_V_MSG(err != OK, Ref<ImportInfo>(), "Could not parse cached import data for " + String(p_dict.get("import_md_path", "")));
+			r_iinfo = iinfo;
+		} break;
+		case IInfoType::V2: {
+			Ref<ImportInfov2> iinfo = memnew(ImportInfov2);
+			iinfo->type = p_dict.get("type", "");
+			iinfo->dest_files = p_dict.get("dest_files", Vector<String>());
+			iinfo->v2metadata->set_editor(p_dict.get("editor", ""));
+			Array sources = p_dict.get("sources", Array());
+			for (int i = 0; i + 1 < sources.size(); i += 2) {
+				iinfo->v2metadata->add_source(sources[i], sources[i + 1]);
+			}
+			Dictionary options = p_dict.get("options", Dictionary());
+			Array keys = options.keys();
+			for (int i = 0; i < keys.size(); i++) {
+				iinfo->v2metadata->set_option(keys[i], options[keys[i]]);
+			}
+			r_iinfo = iinfo;
+		} break;
+		case IInfoType::DUMMY:
+		case IInfoType::REMAP: {
+			Ref<ImportInfoDummy> iinfo;
+			if ((int)p_dict["iitype"] == IInfoType::REMAP) {
+				Ref<ImportInfoRemap> remap = memnew(ImportInfoRemap);
+				remap->importer = p_dict.get("importer", "<NONE>");
+				iinfo = remap;
+			} else {
+				iinfo = memnew(ImportInfoDummy);
+			}
+			iinfo->type = p_dict.get("type", "");
+			iinfo->source_file = p_dict.get("source_file", "");
+			iinfo->src_md5 = p_dict.get("src_md5", "");
+			iinfo->dest_files = p_dict.get("dest_files", Vector<String>());
+			r_iinfo = iinfo;
+		} break;
+		default:
+			ERR_FAIL_V_MSG(Ref<ImportInfo>(), "Unknown cached import info type");
+	}
+	r_iinfo->import_md_path = p_dict.get("import_md_path", "");
+	r_iinfo->ver_major = p_dict.get("ver_major", 0);
+	r_iinfo->ver_minor = p_dict.get("ver_minor", 0);
+	r_iinfo->format_ver = p_dict.get("format_ver", 0);
+	r_iinfo->not_an_import = p_dict.get("not_an_import", false);
+	r_iinfo->auto_converted_export = p_dict.get("auto_converted_export", false);
+	r_iinfo->dirty = p_dict.get("dirty", false);
+	r_iinfo->preferred_import_path = p_dict.get("preferred_import_path", "");
+	r_iinfo->export_dest = p_dict.get("export_dest", "");
+	r_iinfo->export_lossless_copy = p_dict.get("export_lossless_copy", "");
+	return r_iinfo;
+}
+
 ImportInfo::ImportInfo() :
 		RefCounted() {
 	import_md_path = "";
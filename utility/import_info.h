@@ -171,6 +171,9 @@ public:
 	virtual Error save_to(const String &p_path) = 0;
 	static Error get_resource_info(const String &p_path, ResourceInfo &i_info);
 	static Ref<ImportInfo> copy(const Ref<ImportInfo> &p_iinfo);
+	// Flattens an ImportInfo into a Dictionary of plain values, for the pack index cache
+	static Dictionary serialize(const Ref<ImportInfo> &p_iinfo);
+	static Ref<ImportInfo> deserialize(const Dictionary &p_dict);
 	static Ref<ImportInfo> load_from_file(const String &p_path, int ver_major = 0, int ver_minor = 0);
 	ImportInfo();
 
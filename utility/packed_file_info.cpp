@@ -1,5 +1,7 @@
 #include "packed_file_info.h"
 
+#include "utility/file_access_gdre.h"
+
 void PackedFileInfo::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_pack"), &PackedFileInfo::get_pack);
 	ClassDB::bind_method(D_METHOD("get_path"), &PackedFileInfo::get_path);
@@ -13,11 +15,17 @@ void PackedFileInfo::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_checksum_validated"), &PackedFileInfo::is_checksum_validated);
 }
 
+void PackedFileInfo::set_md5_match(bool pass) {
+	md5_passed = pass;
+	// Infos are created per listing, so the result is kept in the pack index
+	GDREPackedData::get_singleton()->set_md5_match(path, pass);
+}
+
 #define PATH_REPLACER "_"
 
-void PackedFileInfo::fix_path() {
-	path = raw_path;
-	malformed_path = false;
+String PackedFileInfo::get_fixed_path(const String &p_raw_path, bool &r_malformed) {
+	String path = p_raw_path;
+	bool malformed_path = false;
 	String prefix = "";
 
 	//remove prefix first
@@ -90,4 +98,10 @@ void PackedFileInfo::fix_path() {
 	if (prefix != "") {
 		path = prefix + path;
 	}
-}
\ No newline at end of file
+	r_malformed = malformed_path;
+	return path;
+}
+
+void PackedFileInfo::fix_path() {
+	path = get_fixed_path(raw_path, malformed_path);
+}
@@ -13,6 +13,7 @@ class PackedFileInfo : public RefCounted {
 	friend class GDREPackedSource;
 	friend class APKArchive;
 	friend class GDREFolderSource;
+	friend class GDREPackedData;
 
 	String path;
 	String raw_path;
@@ -21,7 +22,7 @@ class PackedFileInfo : public RefCounted {
 	bool md5_passed = false;
 	uint32_t flags;
 
-	void set_md5_match(bool pass) { md5_passed = pass; }
+	void set_md5_match(bool pass);
 
 public:
 	void init(const String &p_path, const PackedData::PackedFile *pfstruct) {
@@ -66,6 +67,8 @@ public:
 	bool is_checksum_validated() const {
 		return md5_passed;
 	}
+	// Returns the path a pack entry's raw path will be stored under, with the prefix kept and invalid characters replaced
+	static String get_fixed_path(const String &p_raw_path, bool &r_malformed);
 
 protected:
 	static void _bind_methods();
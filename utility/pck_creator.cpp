@@ -0,0 +1,699 @@
+#include "pck_creator.h"
+
+#include "core/crypto/crypto_core.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access_encrypted.h"
+#include "core/io/file_access_memory.h"
+#include "core/io/file_access_pack.h"
+#include "core/math/math_funcs.h"
+#include "core/os/os.h"
+#include "utility/common.h"
+#include "utility/gdre_settings.h"
+
+namespace {
+// Padding between the directory and the file data
+constexpr int PCK_PADDING = 16;
+// Buffer used to hash files and to stream large files into the pack
+constexpr int64_t COPY_BUFFER_SIZE = 1024 * 1024;
+// Files are read (and encrypted) ahead on the workers in windows of about this many bytes, then written in order.
+// Unencrypted files larger than this are streamed straight from disk instead.
+constexpr uint64_t WRITE_WINDOW_SIZE = 64 * 1024 * 1024;
+// FileAccessEncrypted prefixes the data with its md5, its length and the IV
+constexpr uint64_t ENCRYPTED_HEADER_SIZE = 16 + 8 + 16;
+
+int get_pad(int p_alignment, int64_t p_n) {
+	int rest = p_n % p_alignment;
+	return rest > 0 ? p_alignment - rest : 0;
+}
+
+uint64_t get_encrypted_size(uint64_t p_size) {
+	return ENCRYPTED_HEADER_SIZE + p_size + get_pad(16, p_size);
+}
+
+// Encrypts p_data the same way FileAccessEncrypted writes it to a pack
+Error encrypt_buffer(const Vector<uint8_t> &p_data, const Vector<uint8_t> &p_key, Vector<uint8_t> &r_out) {
+	r_out.resize(get_encrypted_size(p_data.size()));
+	Ref<FileAccessMemory> fm;
+	fm.instantiate();
+	Error err = fm->open_custom(r_out.ptrw(), r_out.size());
+	ERR_FAIL_COND_V(err != OK, err);
+	Ref<FileAccessEncrypted> fae;
+	fae.instantiate();
+	err = fae->open_and_parse(fm, p_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+	ERR_FAIL_COND_V(err != OK, err);
+	fae->store_buffer(p_data.ptr(), p_data.size());
+	fae->close();
+	ERR_FAIL_COND_V_MSG(fm->get_position() != (uint64_t)r_out.size(), ERR_BUG, "Unexpected encrypted file size");
+	return OK;
+}
+
+String get_error_type(Error p_err) {
+	switch (p_err) {
+		case ERR_FILE_CANT_OPEN:
+			return "FileAccess error";
+		case ERR_FILE_CANT_READ:
+			return "FileRead error";
+		case ERR_FILE_CANT_WRITE:
+			return "FileWrite error";
+		case ERR_UNAVAILABLE:
+			return "Encryption error";
+		default:
+			return "Unknown error";
+	}
+}
+} //namespace
+
+void PckCreator::reset() {
+	cancelled = false;
+	last_completed = -1;
+	broken_cnt = 0;
+	key.clear();
+}
+
+void PckCreator::set_engine_version(int p_major, int p_minor, int p_rev) {
+	ver_major = p_major;
+	ver_minor = p_minor;
+	ver_rev = p_rev;
+}
+
+void PckCreator::set_encrypt_filters(const Vector<String> &p_include, const Vector<String> &p_exclude) {
+	encrypt_include_filters.clear();
+	encrypt_exclude_filters.clear();
+	for (const String &filter : p_include) {
+		if (!filter.strip_edges().is_empty()) {
+			encrypt_include_filters.push_back(filter.strip_edges());
+		}
+	}
+	for (const String &filter : p_exclude) {
+		if (!filter.strip_edges().is_empty()) {
+			encrypt_exclude_filters.push_back(filter.strip_edges());
+		}
+	}
+}
+
+bool PckCreator::_should_encrypt(const String &p_path) const {
+	String res_path = "res://" + p_path;
+	bool encrypt = false;
+	for (const String &filter : encrypt_include_filters) {
+		if (p_path.matchn(filter) || res_path.matchn(filter)) {
+			encrypt = true;
+			break;
+		}
+	}
+	if (!encrypt) {
+		return false;
+	}
+	for (const String &filter : encrypt_exclude_filters) {
+		if (p_path.matchn(filter) || res_path.matchn(filter)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+Vector<String> PckCreator::get_files_to_pack(const String &p_dir) {
+	Vector<String> files = gdre::get_recursive_dir_list(p_dir, {}, false);
+	// Sorted so that packing the same directory twice gives the same pack
+	files.sort();
+	return files;
+}
+
+void PckCreator::_do_buffer_file(uint32_t i, FileToken *tokens) {
+	FileToken &token = tokens[i];
+	if (cancelled) {
+		return;
+	}
+	last_completed++;
+	token.buffered = true;
+	Ref<FileAccess> fa = FileAccess::open(token.src_path, FileAccess::READ);
+	if (fa.is_null()) {
+		token.err = ERR_FILE_CANT_OPEN;
+		return;
+	}
+	Vector<uint8_t> contents;
+	contents.resize(token.size);
+	if (fa->get_buffer(contents.ptrw(), token.size) != token.size) {
+		token.err = ERR_FILE_CANT_READ;
+		return;
+	}
+	CryptoCore::md5(contents.ptr(), contents.size(), token.md5);
+	if (!token.encrypted) {
+		token.data = contents;
+	} else if (encrypt_buffer(contents, key, token.data) != OK) {
+		token.data.clear();
+		token.err = ERR_UNAVAILABLE;
+	}
+}
+
+Error PckCreator::_write_file(const Ref<FileAccess> &f, FileToken &token, Vector<uint8_t> &buffer) {
+	Error err = token.err;
+	uint64_t written = 0;
+	if (token.buffered) {
+		if (err == OK) {
+			f->store_buffer(token.data.ptr(), token.data.size());
+			written = token.data.size();
+		}
+		token.data.clear();
+	} else {
+		Ref<FileAccess> fa = FileAccess::open(token.src_path, FileAccess::READ);
+		if (fa.is_null()) {
+			err = ERR_FILE_CANT_OPEN;
+		} else {
+			if (buffer.size() < COPY_BUFFER_SIZE) {
+				buffer.resize(COPY_BUFFER_SIZE);
+			}
+			CryptoCore::MD5Context ctx;
+			ctx.start();
+			while (written < token.stored_size) {
+				uint64_t got = fa->get_buffer(buffer.ptrw(), MIN((uint64_t)buffer.size(), token.stored_size - written));
+				if (got == 0 || got > token.stored_size - written) {
+					break;
+				}
+				ctx.update(buffer.ptr(), got);
+				f->store_buffer(buffer.ptr(), got);
+				written += got;
+			}
+			ctx.finish(token.md5);
+		}
+	}
+	if (written != token.stored_size) {
+		// The directory has already been written, so keep the following entries where it says they are
+		if (err == OK) {
+			err = ERR_FILE_CANT_READ;
+		}
+		for (uint64_t j = written; j < token.stored_size; j++) {
+			f->store_8(0);
+		}
+	}
+	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
+		err = ERR_FILE_CANT_WRITE;
+	}
+	token.err = err;
+	return err;
+}
+
+Error PckCreator::wait_for_task(WorkerThreadPool::GroupID group_task, const Vector<FileToken> &tokens, int p_offset, EditorProgressGDDC *pr) {
+	if (pr) {
+		while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+			OS::get_singleton()->delay_usec(10000);
+			int i = CLAMP(p_offset + (int)last_completed, 0, tokens.size() - 1);
+			bool cancel = pr->step(tokens[i].path, i, true);
+			if (cancel) {
+				cancelled = true;
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+				return ERR_PRINTER_ON_FIRE;
+			}
+		}
+	}
+
+	// Always wait for completion; otherwise we leak memory.
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	return OK;
+}
+
+Error PckCreator::_copy_executable(const Ref<FileAccess> &f, String &error_string) {
+	Ref<FileAccess> fs = FileAccess::open(embed_source, FileAccess::READ);
+	if (fs.is_null()) {
+		error_string += "Error opening source executable file: " + embed_source + "\n";
+		return ERR_FILE_CANT_OPEN;
+	}
+	fs->seek_end();
+	fs->seek(fs->get_position() - 4);
+	uint32_t magic = fs->get_32();
+	if (magic == PACK_HEADER_MAGIC) {
+		// The executable already has an embedded pack; leave it out
+		fs->seek(fs->get_position() - 12);
+		uint64_t ds = fs->get_64();
+		fs->seek(fs->get_position() - ds - 8);
+	} else {
+		fs->seek_end();
+	}
+	uint64_t exe_end = fs->get_position();
+	fs->seek(0);
+	Vector<uint8_t> buffer;
+	buffer.resize(COPY_BUFFER_SIZE);
+	uint64_t remaining = exe_end;
+	while (remaining > 0) {
+		uint64_t got = fs->get_buffer(buffer.ptrw(), MIN((uint64_t)buffer.size(), remaining));
+		if (got == 0 || got > remaining) {
+			error_string += "Error reading source executable file: " + embed_source + "\n";
+			return ERR_FILE_CANT_READ;
+		}
+		f->store_buffer(buffer.ptr(), got);
+		remaining -= got;
+	}
+	return OK;
+}
+
+Error PckCreator::_fix_embedded_headers(const Ref<FileAccess> &f, int64_t embedded_start, int64_t embedded_size, String &error_string) {
+	f->seek(0);
+	int16_t exe1_magic = f->get_16();
+	int16_t exe2_magic = f->get_16();
+	if (exe1_magic == 0x5A4D) {
+		//windows (pe) - copy from "platform/windows/export/export.cpp"
+		f->seek(0x3c);
+		uint32_t pe_pos = f->get_32();
+
+		f->seek(pe_pos);
+		uint32_t magic = f->get_32();
+		if (magic != 0x00004550) {
+			error_string += "Invalid PE magic\n";
+			return ERR_FILE_CORRUPT;
+		}
+
+		// Process header
+		int num_sections;
+		{
+			int64_t header_pos = f->get_position();
+
+			f->seek(header_pos + 2);
+			num_sections = f->get_16();
+			f->seek(header_pos + 16);
+			uint16_t opt_header_size = f->get_16();
+
+			// Skip rest of header + optional header to go to the section headers
+			f->seek(f->get_position() + 2 + opt_header_size);
+		}
+
+		// Search for the "pck" section
+		int64_t section_table_pos = f->get_position();
+
+		for (int i = 0; i < num_sections; ++i) {
+			int64_t section_header_pos = section_table_pos + i * 40;
+			f->seek(section_header_pos);
+
+			uint8_t section_name[9];
+			f->get_buffer(section_name, 8);
+			section_name[8] = '\0';
+
+			if (strcmp((char *)section_name, "pck") == 0) {
+				// "pck" section found, let's patch!
+
+				// Set virtual size to a little to avoid it taking memory (zero would give issues)
+				f->seek(section_header_pos + 8);
+				f->store_32(8);
+
+				f->seek(section_header_pos + 16);
+				f->store_32(embedded_size);
+				f->seek(section_header_pos + 20);
+				f->store_32(embedded_start);
+
+				break;
+			}
+		}
+	} else if ((exe1_magic == 0x457F) && (exe2_magic == 0x467C)) {
+		// linux (elf) - copy from "platform/x11/export/export.cpp"
+		// Read program architecture bits from class field
+		int bits = f->get_8() * 32;
+
+		if (bits == 32 && embedded_size >= 0x100000000) {
+			error_string += "32-bit executables cannot have embedded data >= 4 GiB\n";
+			return ERR_INVALID_DATA;
+		}
+
+		// Get info about the section header table
+		int64_t section_table_pos;
+		int64_t section_header_size;
+		if (bits == 32) {
+			section_header_size = 40;
+			f->seek(0x20);
+			section_table_pos = f->get_32();
+			f->seek(0x30);
+		} else { // 64
+			section_header_size = 64;
+			f->seek(0x28);
+			section_table_pos = f->get_64();
+			f->seek(0x3c);
+		}
+		int num_sections = f->get_16();
+		int string_section_idx = f->get_16();
+
+		// Load the strings table
+		Vector<uint8_t> strings;
+		{
+			// Jump to the strings section header
+			f->seek(section_table_pos + string_section_idx * section_header_size);
+
+			// Read strings data size and offset
+			int64_t string_data_pos;
+			int64_t string_data_size;
+			if (bits == 32) {
+				f->seek(f->get_position() + 0x10);
+				string_data_pos = f->get_32();
+				string_data_size = f->get_32();
+			} else { // 64
+				f->seek(f->get_position() + 0x18);
+				string_data_pos = f->get_64();
+				string_data_size = f->get_64();
+			}
+
+			// Read strings data, terminated so a bad name offset can't run off the end
+			f->seek(string_data_pos);
+			if (strings.resize(string_data_size + 1) != OK) {
+				error_string += "Out of memory\n";
+				return ERR_OUT_OF_MEMORY;
+			}
+			f->get_buffer(strings.ptrw(), string_data_size);
+			strings.write[string_data_size] = 0;
+		}
+
+		// Search for the "pck" section
+		for (int i = 0; i < num_sections; ++i) {
+			int64_t section_header_pos = section_table_pos + i * section_header_size;
+			f->seek(section_header_pos);
+
+			uint32_t name_offset = f->get_32();
+			if (name_offset < (uint32_t)strings.size() && strcmp((const char *)strings.ptr() + name_offset, "pck") == 0) {
+				// "pck" section found, let's patch!
+
+				if (bits == 32) {
+					f->seek(section_header_pos + 0x10);
+					f->store_32(embedded_start);
+					f->store_32(embedded_size);
+				} else { // 64
+					f->seek(section_header_pos + 0x18);
+					f->store_64(embedded_start);
+					f->store_64(embedded_size);
+				}
+
+				break;
+			}
+		}
+	}
+	return OK;
+}
+
+Error PckCreator::_write_directory(const Ref<FileAccess> &f, int64_t p_dir_pos, int64_t p_file_base, const Vector<CharString> &p_names, const Vector<FileToken> &p_tokens) {
+	f->seek(p_dir_pos);
+	Ref<FileAccessEncrypted> fae;
+	Ref<FileAccess> fhead = f;
+	if (pack_version == 2 && encrypt_dir) {
+		fae.instantiate();
+		Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+		ERR_FAIL_COND_V(err != OK, err);
+		fhead = fae;
+	}
+
+	for (int i = 0; i < p_tokens.size(); i++) {
+		uint32_t string_len = p_names[i].length();
+		uint32_t pad = get_pad(4, string_len);
+
+		fhead->store_32(string_len + pad);
+		fhead->store_buffer((const uint8_t *)p_names[i].get_data(), string_len);
+		for (uint32_t j = 0; j < pad; j++) {
+			fhead->store_8(0);
+		}
+
+		if (pack_version == 2) {
+			fhead->store_64(p_tokens[i].offset);
+		} else {
+			fhead->store_64(p_tokens[i].offset + p_file_base);
+		}
+		fhead->store_64(p_tokens[i].size);
+		fhead->store_buffer(p_tokens[i].md5, 16);
+		if (pack_version == 2) {
+			fhead->store_32(p_tokens[i].encrypted ? PACK_FILE_ENCRYPTED : 0);
+		}
+	}
+
+	if (fae.is_valid()) {
+		fae->close();
+	}
+	return OK;
+}
+
+Error PckCreator::_pck_create(const String &p_pck_path, const String &p_dir, const Vector<String> &p_files, EditorProgressGDDC *pr, String &error_string) {
+	reset();
+	ERR_FAIL_COND_V_MSG(p_files.is_empty(), ERR_FILE_NOT_FOUND, "No files to pack in " + p_dir);
+	ERR_FAIL_COND_V_MSG(pack_version != 1 && pack_version != 2, ERR_INVALID_PARAMETER, "Unsupported pack version: " + itos(pack_version));
+	key = encryption_key.is_empty() ? GDRESettings::get_singleton()->get_encryption_key() : encryption_key;
+
+	Vector<FileToken> tokens;
+	tokens.resize(p_files.size());
+	bool needs_key = pack_version == 2 && encrypt_dir;
+	for (int i = 0; i < p_files.size(); i++) {
+		FileToken &token = tokens.write[i];
+		token.path = p_files[i];
+		token.src_path = p_dir.path_join(p_files[i]);
+		// Only format version 2 supports encryption
+		token.encrypted = pack_version == 2 && _should_encrypt(token.path);
+		needs_key = needs_key || token.encrypted;
+	}
+	ERR_FAIL_COND_V_MSG(needs_key && key.size() != 32, ERR_INVALID_PARAMETER, "A 256-bit encryption key is required to encrypt the pack.");
+
+	// Only the sizes are needed to lay out the pack. The MD5s are worked out while the files are copied,
+	// and the directory is written last, once all of them are known.
+	uint64_t start_time = OS::get_singleton()->get_ticks_usec();
+	Error err = OK;
+	for (int i = 0; i < tokens.size(); i++) {
+		if (pr && pr->step(tokens[i].path, i, false)) {
+			return ERR_PRINTER_ON_FIRE;
+		}
+		FileToken &token = tokens.write[i];
+		Ref<FileAccess> fa = FileAccess::open(token.src_path, FileAccess::READ);
+		if (fa.is_null()) {
+			token.err = ERR_FILE_CANT_OPEN;
+			broken_cnt++;
+			continue;
+		}
+		token.size = fa->get_length();
+	}
+
+	// Files we couldn't read are left out of the pack
+	if (broken_cnt > 0) {
+		Vector<FileToken> readable;
+		for (const FileToken &token : tokens) {
+			if (token.err != OK) {
+				error_string += token.path + " (" + get_error_type(token.err) + ")\n";
+			} else {
+				readable.push_back(token);
+			}
+		}
+		tokens = readable;
+		ERR_FAIL_COND_V_MSG(tokens.is_empty(), ERR_FILE_CANT_READ, "Could not read any of the files in " + p_dir);
+	}
+	uint64_t data_size = 0;
+	for (FileToken &token : tokens) {
+		token.stored_size = token.encrypted ? get_encrypted_size(token.size) : token.size;
+		token.offset = data_size;
+		data_size += token.stored_size;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(p_pck_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_FILE_CANT_WRITE, "Error opening PCK file: " + p_pck_path);
+	// Don't leave a partially written pack behind
+	auto discard_output = [&](Error p_err) {
+		f->close();
+		DirAccess::remove_absolute(p_pck_path);
+		return p_err;
+	};
+
+	int64_t embedded_start = 0;
+	if (!embed_source.is_empty()) {
+		err = _copy_executable(f, error_string);
+		if (err != OK) {
+			return discard_output(err);
+		}
+		embedded_start = f->get_position();
+		// ensure embedded PCK starts at a 64-bit multiple
+		int pad = get_pad(8, f->get_position());
+		for (int i = 0; i < pad; i++) {
+			f->store_8(0);
+		}
+	}
+	int64_t pck_start_pos = f->get_position();
+
+	f->store_32(PACK_HEADER_MAGIC);
+	f->store_32(pack_version);
+	f->store_32(ver_major);
+	f->store_32(ver_minor);
+	f->store_32(ver_rev);
+
+	int64_t file_base_ofs = 0;
+	if (pack_version == 2) {
+		uint32_t pack_flags = 0;
+		if (encrypt_dir) {
+			pack_flags |= PACK_DIR_ENCRYPTED;
+		}
+		f->store_32(pack_flags); // flags
+		file_base_ofs = f->get_position();
+		f->store_64(0); // files base
+	}
+
+	for (int i = 0; i < 16; i++) {
+		//reserved
+		f->store_32(0);
+	}
+
+	f->store_32(tokens.size()); //amount of files
+
+	int64_t dir_pos = f->get_position();
+	uint64_t dir_size = 0;
+	Vector<CharString> names;
+	names.resize(tokens.size());
+	for (int i = 0; i < tokens.size(); i++) {
+		names.write[i] = ("res://" + tokens[i].path).utf8();
+		uint32_t string_len = names[i].length();
+		dir_size += 4; // size of path string (32 bits is enough)
+		dir_size += string_len + get_pad(4, string_len); ///size of path string
+		dir_size += 8; // offset to file _with_ header size included
+		dir_size += 8; // size of file
+		dir_size += 16; // md5
+		if (pack_version == 2) {
+			dir_size += 4; // flags
+		}
+	}
+	if (pack_version == 2 && encrypt_dir) {
+		dir_size = get_encrypted_size(dir_size);
+	}
+	// Hold the directory's place until the MD5s are known
+	{
+		Vector<uint8_t> placeholder;
+		placeholder.resize(dir_size);
+		placeholder.fill(0);
+		f->store_buffer(placeholder.ptr(), placeholder.size());
+	}
+
+	int header_padding = get_pad(PCK_PADDING, f->get_position());
+	for (int j = 0; j < header_padding; j++) {
+		if (pack_version == 2) {
+			f->store_8(Math::rand() % 256);
+		} else {
+			f->store_8(0);
+		}
+	}
+	int64_t file_base = f->get_position();
+
+	if (pack_version == 2) {
+		f->seek(file_base_ofs);
+		f->store_64(file_base); // update files base
+		f->seek(file_base);
+	}
+
+	// Read, hash (and encrypt) a window of files on the workers, then write it out in order
+	Vector<uint8_t> buffer;
+	int i = 0;
+	while (i < tokens.size()) {
+		int window_end = i;
+		uint64_t window_bytes = 0;
+		while (window_end < tokens.size() && (window_end == i || window_bytes + tokens[window_end].size <= WRITE_WINDOW_SIZE)) {
+			window_bytes += tokens[window_end].size;
+			window_end++;
+		}
+		bool stream = window_end - i == 1 && !tokens[i].encrypted && tokens[i].size > WRITE_WINDOW_SIZE;
+		if (!stream) {
+			last_completed = -1;
+			if (opt_multi_thread && window_end - i > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
+						this,
+						&PckCreator::_do_buffer_file,
+						tokens.ptrw() + i,
+						window_end - i, -1, true, SNAME("PckCreator::_do_buffer_file"));
+				err = wait_for_task(group_task, tokens, i, pr);
+			} else {
+				for (int j = i; j < window_end; j++) {
+					_do_buffer_file(j - i, tokens.ptrw() + i);
+				}
+			}
+		}
+		if (err == ERR_PRINTER_ON_FIRE) {
+			break;
+		}
+		for (; i < window_end; i++) {
+			if (pr && pr->step(tokens[i].path, i, false)) {
+				cancelled = true;
+				err = ERR_PRINTER_ON_FIRE;
+				break;
+			}
+			Error write_err = _write_file(f, tokens.write[i], buffer);
+			if (write_err != OK) {
+				error_string += tokens[i].path + " (" + get_error_type(write_err) + ")\n";
+				if (write_err == ERR_FILE_CANT_WRITE) {
+					return discard_output(write_err);
+				}
+			}
+		}
+		if (err == ERR_PRINTER_ON_FIRE) {
+			break;
+		}
+	}
+	if (err == ERR_PRINTER_ON_FIRE) {
+		return discard_output(err);
+	}
+
+	uint64_t data_end = f->get_position();
+	err = _write_directory(f, dir_pos, file_base, names, tokens);
+	if (err != OK) {
+		return discard_output(err);
+	}
+	if (f->get_position() - dir_pos > dir_size) {
+		ERR_PRINT("Pack directory is larger than the space reserved for it");
+		return discard_output(ERR_BUG);
+	}
+	f->seek(data_end);
+	uint64_t usec = OS::get_singleton()->get_ticks_usec() - start_time;
+
+	if (!watermark.is_empty()) {
+		f->store_32(0);
+		f->store_32(0);
+		f->store_string(watermark);
+		f->store_32(0);
+		f->store_32(0);
+	}
+
+	f->store_32(PACK_HEADER_MAGIC);
+
+	if (!embed_source.is_empty()) {
+		// ensure embedded data ends at a 64-bit multiple
+		int pad = get_pad(8, f->get_position() - embedded_start + 12);
+		for (int j = 0; j < pad; j++) {
+			f->store_8(0);
+		}
+
+		int64_t pck_size = f->get_position() - pck_start_pos;
+		f->store_64(pck_size);
+		f->store_32(PACK_HEADER_MAGIC);
+
+		int64_t embedded_size = f->get_position() - embedded_start;
+		err = _fix_embedded_headers(f, embedded_start, embedded_size, error_string);
+		if (err != OK) {
+			return discard_output(err);
+		}
+	}
+	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
+		return discard_output(ERR_FILE_CANT_WRITE);
+	}
+	f->close();
+
+	print_line("Packed " + itos(tokens.size()) + " files (" + String::humanize_size(data_size) + ") in " + String::num((double)usec / 1000000.0, 2) + "s");
+	if (error_string.length() > 0) {
+		print_error("At least one error was detected while creating pack!\n" + error_string);
+	}
+	return OK;
+}
+
+Error PckCreator::pck_create(const String &p_pck_path, const String &p_dir) {
+	String error_string;
+	Error err = _pck_create(p_pck_path, p_dir, get_files_to_pack(p_dir), nullptr, error_string);
+	if (err == OK && !error_string.is_empty()) {
+		return ERR_FILE_CANT_READ;
+	}
+	return err;
+}
+
+void PckCreator::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("pck_create", "pck_path", "dir"), &PckCreator::pck_create);
+	ClassDB::bind_method(D_METHOD("set_pack_version", "version"), &PckCreator::set_pack_version);
+	ClassDB::bind_method(D_METHOD("get_pack_version"), &PckCreator::get_pack_version);
+	ClassDB::bind_method(D_METHOD("set_engine_version", "major", "minor", "rev"), &PckCreator::set_engine_version);
+	ClassDB::bind_method(D_METHOD("set_encrypt_dir", "encrypt"), &PckCreator::set_encrypt_dir);
+	ClassDB::bind_method(D_METHOD("get_encrypt_dir"), &PckCreator::get_encrypt_dir);
+	ClassDB::bind_method(D_METHOD("set_encrypt_filters", "include", "exclude"), &PckCreator::set_encrypt_filters);
+	ClassDB::bind_method(D_METHOD("set_encryption_key", "key"), &PckCreator::set_encryption_key);
+	ClassDB::bind_method(D_METHOD("set_embed_source", "path"), &PckCreator::set_embed_source);
+	ClassDB::bind_method(D_METHOD("get_embed_source"), &PckCreator::get_embed_source);
+	ClassDB::bind_method(D_METHOD("set_watermark", "watermark"), &PckCreator::set_watermark);
+	ClassDB::bind_method(D_METHOD("get_watermark"), &PckCreator::get_watermark);
+	ClassDB::bind_method(D_METHOD("set_multi_thread", "multi_thread"), &PckCreator::set_multi_thread);
+	ClassDB::bind_static_method(get_class_static(), D_METHOD("get_files_to_pack", "dir"), &PckCreator::get_files_to_pack);
+}
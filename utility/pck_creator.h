@@ -0,0 +1,79 @@
+#pragma once
+
+#include "core/io/file_access.h"
+#include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
+
+#include "editor/gdre_progress.h"
+
+// Builds a PCK (optionally embedded into an executable) out of a directory.
+// Files are read, hashed and encrypted on the worker pool, then written to the pack in directory order;
+// the directory itself is written last, once every file's MD5 is known.
+class PckCreator : public RefCounted {
+	GDCLASS(PckCreator, RefCounted)
+	int pack_version = 2;
+	int ver_major = 4;
+	int ver_minor = 0;
+	int ver_rev = 0;
+	bool encrypt_dir = false;
+	Vector<String> encrypt_include_filters;
+	Vector<String> encrypt_exclude_filters;
+	Vector<uint8_t> encryption_key;
+	String embed_source;
+	String watermark;
+	bool opt_multi_thread = true;
+	std::atomic<bool> cancelled = false;
+	std::atomic<int> last_completed = 0;
+	std::atomic<int> broken_cnt = 0;
+
+	struct FileToken {
+		String path; // relative to the source directory
+		String src_path;
+		uint64_t size = 0;
+		uint64_t stored_size = 0; // size of the entry in the pack, larger than `size` if it's encrypted
+		uint64_t offset = 0;
+		bool encrypted = false;
+		uint8_t md5[16] = {};
+		// Contents as they will be stored in the pack; filled in (and hashed) by the workers right before the entry is written
+		Vector<uint8_t> data;
+		bool buffered = false;
+		Error err = OK;
+	};
+	// Key the current pack is being encrypted with
+	Vector<uint8_t> key;
+
+	void reset();
+	bool _should_encrypt(const String &p_path) const;
+	void _do_buffer_file(uint32_t i, FileToken *tokens);
+	Error _write_file(const Ref<FileAccess> &f, FileToken &token, Vector<uint8_t> &buffer);
+	Error _write_directory(const Ref<FileAccess> &f, int64_t p_dir_pos, int64_t p_file_base, const Vector<CharString> &p_names, const Vector<FileToken> &p_tokens);
+	Error _copy_executable(const Ref<FileAccess> &f, String &error_string);
+	Error _fix_embedded_headers(const Ref<FileAccess> &f, int64_t embedded_start, int64_t embedded_size, String &error_string);
+	Error wait_for_task(WorkerThreadPool::GroupID group_task, const Vector<FileToken> &tokens, int p_offset, EditorProgressGDDC *pr);
+
+protected:
+	static void _bind_methods();
+
+public:
+	// Paths of every file under p_dir relative to it, in the order they will be packed.
+	static Vector<String> get_files_to_pack(const String &p_dir);
+
+	Error _pck_create(const String &p_pck_path, const String &p_dir, const Vector<String> &p_files, EditorProgressGDDC *pr, String &error_string);
+	Error pck_create(const String &p_pck_path, const String &p_dir);
+
+	void set_pack_version(int p_version) { pack_version = p_version; }
+	int get_pack_version() const { return pack_version; }
+	void set_engine_version(int p_major, int p_minor, int p_rev);
+	void set_encrypt_dir(bool p_encrypt) { encrypt_dir = p_encrypt; }
+	bool get_encrypt_dir() const { return encrypt_dir; }
+	// Files matching any of the include filters (and none of the exclude filters) are encrypted.
+	void set_encrypt_filters(const Vector<String> &p_include, const Vector<String> &p_exclude);
+	// Defaults to the key set in GDRESettings.
+	void set_encryption_key(const Vector<uint8_t> &p_key) { encryption_key = p_key; }
+	// Executable to embed the pack into; if empty, a standalone pack is created.
+	void set_embed_source(const String &p_path) { embed_source = p_path; }
+	String get_embed_source() const { return embed_source; }
+	void set_watermark(const String &p_watermark) { watermark = p_watermark; }
+	String get_watermark() const { return watermark; }
+	void set_multi_thread(bool multi_thread) { opt_multi_thread = multi_thread; }
+};
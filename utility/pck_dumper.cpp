@@ -2,23 +2,164 @@
 #include "core/error/error_list.h"
 #include "gdre_settings.h"
 
+#include "core/crypto/crypto_core.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/os/os.h"
 #include "utility/common.h"
+#include "utility/file_access_mmap.h"
+#include "utility/gdre_packed_source.h"
 #include "utility/packed_file_info.h"
 
-const static Vector<uint8_t> empty_md5 = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
-bool PckDumper::_pck_file_check_md5(Ref<PackedFileInfo> &file) {
-	// Loading an encrypted file automatically checks the md5
-	if (file->is_encrypted()) {
-		return true;
-	}
-	auto hash = FileAccess::get_md5(file->get_path());
-	auto p_md5 = String::md5(file->get_md5().ptr());
-	return hash == p_md5;
+namespace {
+// Userspace copy buffer for entries that can't be copied by the kernel (encrypted, or not in a mapped pack)
+constexpr int64_t EXTRACT_BUFFER_SIZE = 1024 * 1024;
+// Batches are sized so every worker gets a few of them, but never so large that the read-ahead thrashes the page cache
+constexpr uint64_t MIN_BATCH_SIZE = 1024 * 1024;
+constexpr uint64_t MAX_BATCH_SIZE = 64 * 1024 * 1024;
+// Read-ahead block size when verifying packs that aren't memory mapped
+constexpr int64_t VERIFY_READ_AHEAD_SIZE = 4 * 1024 * 1024;
+
+// Copies p_size bytes at p_offset of p_src_fd into a new file at p_target without going through userspace.
+// Returns ERR_UNAVAILABLE if the platform or filesystem can't do this, in which case nothing was written.
+Error kernel_copy_to_file(int p_src_fd, uint64_t p_offset, uint64_t p_size, const String &p_target) {
+#ifdef __linux__
+	if (p_src_fd < 0 || p_target.contains("://")) {
+		return ERR_UNAVAILABLE;
+	}
+	int out_fd = ::open(p_target.utf8().get_data(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (out_fd < 0) {
+		return ERR_UNAVAILABLE;
+	}
+	off_t in_off = p_offset;
+	uint64_t remaining = p_size;
+#ifdef SYS_copy_file_range
+	bool use_sendfile = false;
+#else
+	bool use_sendfile = true;
+#endif
+	while (remaining > 0) {
+		ssize_t copied = -1;
+		size_t chunk = MIN(remaining, (uint64_t)0x7ffff000);
+		if (!use_sendfile) {
+#ifdef SYS_copy_file_range
+			// Called through syscall() so we don't depend on glibc >= 2.27
+			loff_t off = in_off;
+			copied = syscall(SYS_copy_file_range, p_src_fd, &off, out_fd, nullptr, chunk, 0);
+			if (copied > 0) {
+				in_off = off;
+			} else if (copied < 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP)) {
+				use_sendfile = true;
+				continue;
+			}
+#endif
+		} else {
+			copied = sendfile(out_fd, p_src_fd, &in_off, chunk);
+		}
+		if (copied < 0 && errno == EINTR) {
+			continue;
+		}
+		if (copied <= 0) {
+			::close(out_fd);
+			// If we couldn't copy anything at all, let the caller retry it through FileAccess
+			return remaining == p_size ? ERR_UNAVAILABLE : ERR_FILE_CANT_WRITE;
+		}
+		remaining -= copied;
+	}
+	if (::close(out_fd) != 0) {
+		return ERR_FILE_CANT_WRITE;
+	}
+	return OK;
+#else
+	return ERR_UNAVAILABLE;
+#endif
+}
+
+struct ExtractTokenOffsetComparator {
+	template <class T>
+	_FORCE_INLINE_ bool operator()(const T &a, const T &b) const {
+		if (a.file->get_pack() != b.file->get_pack()) {
+			return a.file->get_pack() < b.file->get_pack();
+		}
+		return a.file->get_offset() < b.file->get_offset();
+	}
+};
+// Reads a region of a pack file front to back in large blocks.
+// Used to verify packs we couldn't memory map without a seek and a small read per entry.
+class PackRangeReader {
+	Ref<FileAccess> f;
+	Vector<uint8_t> buffer;
+	uint64_t buffer_start = 0;
+	uint64_t buffer_len = 0;
+	uint64_t range_end = 0;
+
+public:
+	bool open(const String &p_pack_path, uint64_t p_range_end) {
+		f = FileAccess::open(p_pack_path, FileAccess::READ);
+		range_end = p_range_end;
+		buffer_len = 0;
+		return f.is_valid();
+	}
+
+	// Returns up to p_length bytes at p_offset; r_read is 0 on failure.
+	const uint8_t *read(uint64_t p_offset, uint64_t p_length, uint64_t &r_read) {
+		r_read = 0;
+		if (p_offset < buffer_start || p_offset >= buffer_start + buffer_len) {
+			if (f.is_null()) {
+				return nullptr;
+			}
+			uint64_t to_read = MIN((uint64_t)VERIFY_READ_AHEAD_SIZE, MAX(range_end, p_offset + p_length) - p_offset);
+			if (buffer.size() < (int64_t)to_read) {
+				buffer.resize(to_read);
+			}
+			if (f->get_position() != p_offset) {
+				f->seek(p_offset);
+			}
+			buffer_start = p_offset;
+			buffer_len = f->get_buffer(buffer.ptrw(), to_read);
+			if (buffer_len == 0 || buffer_len > to_read) {
+				buffer_len = 0;
+				return nullptr;
+			}
+		}
+		uint64_t ofs = p_offset - buffer_start;
+		r_read = MIN(p_length, buffer_len - ofs);
+		return buffer.ptr() + ofs;
+	}
+};
+
+// Hashes the stored bytes of a pack entry, straight from the mapping if we have one.
+bool hash_pack_entry(const Ref<PackedFileInfo> &p_file, const Ref<MMappedFile> &p_mapping, PackRangeReader &p_reader, uint8_t r_md5[16]) {
+	CryptoCore::MD5Context ctx;
+	ctx.start();
+	if (p_mapping.is_valid()) {
+		ctx.update(p_mapping->get_data() + p_file->get_offset(), p_file->get_size());
+	} else {
+		uint64_t ofs = p_file->get_offset();
+		uint64_t remaining = p_file->get_size();
+		while (remaining > 0) {
+			uint64_t got = 0;
+			const uint8_t *data = p_reader.read(ofs, remaining, got);
+			if (got == 0) {
+				return false;
+			}
+			ctx.update(data, got);
+			ofs += got;
+			remaining -= got;
+		}
+	}
+	ctx.finish(r_md5);
+	return true;
 }
+} // namespace
 
 Error PckDumper::check_md5_all_files() {
 	Vector<String> f;
@@ -26,21 +167,57 @@ Error PckDumper::check_md5_all_files() {
 	return _check_md5_all_files(f, ch, nullptr);
 }
 
-void PckDumper::_do_md5_check(uint32_t i, Ref<PackedFileInfo> *tokens) {
-	// Taken care of in the main thread
-	if (unlikely(cancelled)) {
-		return;
+void PckDumper::_do_md5_check_batch(uint32_t i, ExtractBatch *batches) {
+	ExtractBatch &batch = batches[i];
+	batch.worker = WorkerThreadPool::get_singleton()->get_thread_index();
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	Ref<MMappedFile> mapping;
+	PackRangeReader reader;
+	if (batch.count > 0) {
+		const Ref<PackedFileInfo> &first = batch.tokens[0].file;
+		GDREPackedSource *src = dynamic_cast<GDREPackedSource *>(first->pf.src);
+		if (src) {
+			mapping = src->get_pack_mapping(first->get_pack());
+		}
+		if (mapping.is_valid() && mapping->contains(batch.range_start, batch.range_size)) {
+			mapping->prefetch(batch.range_start, batch.range_size);
+		} else {
+			mapping = Ref<MMappedFile>();
+			reader.open(first->get_pack(), batch.range_start + batch.range_size);
+		}
 	}
-	if (tokens[i]->get_md5() == empty_md5) {
-		skipped_cnt++;
-	} else {
-		tokens[i]->set_md5_match(_pck_file_check_md5(tokens[i]));
-		if (!tokens[i]->md5_passed) {
-			print_error("Checksum failed for " + tokens[i]->get_path());
-			broken_cnt++;
+	for (uint32_t j = 0; j < batch.count; j++) {
+		// Taken care of in the main thread
+		if (unlikely(cancelled)) {
+			break;
+		}
+		ExtractToken &token = batch.tokens[j];
+		const Ref<PackedFileInfo> &file = token.file;
+		if (!file->has_md5()) {
+			token.err = ERR_SKIP;
+			skipped_cnt++;
+		} else if (file->is_encrypted()) {
+			// Loading an encrypted file automatically checks the md5
+			file->set_md5_match(true);
+		} else {
+			uint8_t md5[16];
+			if (!hash_pack_entry(file, mapping, reader, md5)) {
+				token.err = ERR_FILE_CANT_READ;
+			} else if (memcmp(md5, file->pf.md5, 16) != 0) {
+				token.err = ERR_FILE_CORRUPT;
+			}
+			file->set_md5_match(token.err == OK);
+			if (token.err == OK) {
+				batch.bytes += file->get_size();
+				print_verbose("Verified " + file->get_path());
+			} else {
+				print_error("Checksum failed for " + file->get_path());
+				broken_cnt++;
+			}
 		}
+		last_completed++;
 	}
-	last_completed++;
+	batch.usec = OS::get_singleton()->get_ticks_usec() - start;
 }
 
 void PckDumper::reset() {
@@ -86,58 +263,62 @@ Error PckDumper::_check_md5_all_files(Vector<String> &broken_files, int &checked
 	}
 	Error err = OK;
 	auto files = GDRESettings::get_singleton()->get_file_info_list();
-	int skipped_files = 0;
-	if (opt_multi_thread) {
-		Vector<String> paths_to_check;
-		if (pr) {
-			pr->step("Checking MD5 for all files...", 0, true);
-			for (const auto &file : files) {
-				paths_to_check.push_back(file->get_path());
-			}
+	Vector<ExtractToken> tokens;
+	tokens.resize(files.size());
+	for (int i = 0; i < files.size(); i++) {
+		tokens.write[i] = { files[i], String(), OK };
+	}
+	// Verify in pack order, so every worker hashes one contiguous region of the pack
+	Vector<ExtractBatch> batches = _make_extract_batches(tokens);
+	Vector<String> paths_to_check;
+	if (pr) {
+		pr->step("Checking MD5 for all files...", 0, true);
+		paths_to_check.resize(tokens.size());
+		for (int i = 0; i < tokens.size(); i++) {
+			paths_to_check.write[i] = tokens[i].file->get_path();
 		}
+	}
+	uint64_t start_time = OS::get_singleton()->get_ticks_usec();
+	if (opt_multi_thread) {
 		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
 				this,
-				&PckDumper::_do_md5_check,
-				files.ptrw(),
-				files.size(), -1, true, SNAME("PckDumper::_check_md5_all_files"));
+				&PckDumper::_do_md5_check_batch,
+				batches.ptrw(),
+				batches.size(), -1, true, SNAME("PckDumper::_check_md5_all_files"));
 		err = wait_for_task(group_task, paths_to_check, pr);
-		checked_files = last_completed + 1 - skipped_cnt;
-		skipped_files = skipped_cnt;
-		if (broken_cnt > 0) {
-			err = ERR_BUG;
-			for (int i = 0; i < files.size(); i++) {
-				if (files[i]->get_md5() != empty_md5 && !files[i]->md5_passed) {
-					broken_files.push_back(files[i]->get_path());
-				}
-			}
-		}
 	} else {
-		for (int i = 0; i < files.size(); i++) {
+		for (int i = 0; i < batches.size(); i++) {
 			if (pr) {
 				if (OS::get_singleton()->get_ticks_usec() - last_progress_upd > 20000) {
 					last_progress_upd = OS::get_singleton()->get_ticks_usec();
-					bool cancel = pr->step(files[i]->path, i, true);
+					int idx = CLAMP((int)last_completed, 0, tokens.size() - 1);
+					bool cancel = pr->step(paths_to_check[idx], idx, true);
 					if (cancel) {
+						cancelled = true;
 						err = ERR_PRINTER_ON_FIRE;
+						break;
 					}
 				}
 			}
-			if (files[i]->get_md5() == empty_md5) {
-				print_verbose("Skipping MD5 check for " + files[i]->path + " (no MD5 hash found)");
-				skipped_files++;
-				continue;
-			}
-			files.write[i]->set_md5_match(_pck_file_check_md5(files.write[i]));
-			if (files[i]->md5_passed) {
-				print_verbose("Verified " + files[i]->path);
-			} else {
-				print_error("Checksum failed for " + files[i]->path);
-				broken_files.push_back(files[i]->path);
-				err = ERR_BUG;
+			_do_md5_check_batch(i, batches.ptrw());
+		}
+	}
+	uint64_t total_usec = OS::get_singleton()->get_ticks_usec() - start_time;
+	checked_files = last_completed + 1 - skipped_cnt;
+	int skipped_files = skipped_cnt;
+	if (broken_cnt > 0) {
+		if (err == OK) {
+			err = ERR_BUG;
+		}
+		for (int i = 0; i < tokens.size(); i++) {
+			if (tokens[i].err != OK && tokens[i].err != ERR_SKIP) {
+				broken_files.push_back(tokens[i].file->get_path());
 			}
-			checked_files++;
 		}
 	}
+	if (err != ERR_PRINTER_ON_FIRE) {
+		_print_batch_stats(batches, total_usec, "Verified");
+	}
 	if (err == ERR_PRINTER_ON_FIRE) {
 		print_error("Verification cancelled!\n");
 	} else if (err) {
@@ -159,46 +340,150 @@ Error PckDumper::pck_dump_to_dir(const String &dir, const Vector<String> &files_
 	return _pck_dump_to_dir(dir, files_to_extract, nullptr, t);
 }
 
-void PckDumper::_do_extract(uint32_t i, ExtractToken *tokens) {
-	auto &file = tokens[i].file;
-	auto &dir = tokens[i].output_dir;
+Error PckDumper::_extract_file(ExtractToken &token, ExtractBatch &batch, bool &prefetched, Vector<uint8_t> &buffer) {
+	auto &file = token.file;
 	Error err = OK;
 	Ref<FileAccess> pck_f = FileAccess::open(file->get_path(), FileAccess::READ, &err);
 	if (err || pck_f.is_null()) {
-		broken_cnt++;
-		last_completed++;
-		tokens[i].err = ERR_FILE_CANT_OPEN;
-		return;
+		return ERR_FILE_CANT_OPEN;
 	}
-	String target_name = dir.path_join(file->get_path().replace("res://", ""));
+	String target_name = token.output_dir.path_join(file->get_path().replace("res://", ""));
 	err = gdre::ensure_dir(target_name.get_base_dir());
 	if (err != OK) {
-		broken_cnt++;
-		last_completed++;
-		tokens[i].err = ERR_CANT_CREATE;
-		return;
-	}
-	Ref<FileAccess> fa = FileAccess::open(target_name, FileAccess::WRITE, &err);
-	if (err || fa.is_null()) {
-		broken_cnt++;
-		last_completed++;
-		tokens[i].err = ERR_FILE_CANT_WRITE;
-		return;
+		return ERR_CANT_CREATE;
 	}
 
 	int64_t rq_size = file->get_size();
-	uint8_t buf[16384];
-	while (rq_size > 0) {
-		int got = pck_f->get_buffer(buf, MIN(16384, rq_size));
-		fa->store_buffer(buf, got);
-		rq_size -= 16384;
-	}
-	fa->flush();
-	last_completed++;
+	Ref<FileAccessMMap> mapped = FileAccessMMap::get_mmap_access(pck_f);
+	err = ERR_UNAVAILABLE;
+	if (mapped.is_valid()) {
+		// Unencrypted pack entry; the whole batch lives in this pack, so read it all in at once.
+		if (!prefetched) {
+			mapped->get_mapping()->prefetch(batch.range_start, batch.range_size);
+			prefetched = true;
+		}
+		err = kernel_copy_to_file(mapped->get_mapping()->get_fd(), mapped->get_mapping_offset(), MIN((uint64_t)rq_size, mapped->get_length()), target_name);
+	}
+	if (err == ERR_UNAVAILABLE) {
+		Ref<FileAccess> fa = FileAccess::open(target_name, FileAccess::WRITE, &err);
+		if (err || fa.is_null()) {
+			return ERR_FILE_CANT_WRITE;
+		}
+		if (mapped.is_valid()) {
+			fa->store_buffer(mapped->get_data_ptr(), MIN((uint64_t)rq_size, mapped->get_length()));
+		} else {
+			if (buffer.size() < EXTRACT_BUFFER_SIZE) {
+				buffer.resize(EXTRACT_BUFFER_SIZE);
+			}
+			uint8_t *buf = buffer.ptrw();
+			while (rq_size > 0) {
+				int64_t got = pck_f->get_buffer(buf, MIN(EXTRACT_BUFFER_SIZE, rq_size));
+				if (got <= 0) {
+					break;
+				}
+				fa->store_buffer(buf, got);
+				rq_size -= got;
+			}
+			// Large encrypted entries are streamed, so a bad MD5 (e.g. the wrong key) only shows up once they've been read
+			if (pck_f->get_error() == ERR_FILE_CORRUPT) {
+				fa->close();
+				DirAccess::remove_absolute(target_name);
+				return ERR_FILE_CORRUPT;
+			}
+		}
+		fa->flush();
+		err = fa->get_error() == OK || fa->get_error() == ERR_FILE_EOF ? OK : ERR_FILE_CANT_WRITE;
+	}
+	if (err != OK) {
+		return ERR_FILE_CANT_WRITE;
+	}
 	if (file->is_malformed() && file->get_raw_path() != file->get_path()) {
 		print_line("Warning: " + file->get_raw_path() + " is a malformed path!\nSaving to " + file->get_path() + " instead.");
 	}
 	print_verbose("Extracted " + target_name);
+	return OK;
+}
+
+void PckDumper::_do_extract_batch(uint32_t i, ExtractBatch *batches) {
+	ExtractBatch &batch = batches[i];
+	batch.worker = WorkerThreadPool::get_singleton()->get_thread_index();
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	bool prefetched = false;
+	Vector<uint8_t> buffer;
+	for (uint32_t j = 0; j < batch.count; j++) {
+		if (unlikely(cancelled)) {
+			break;
+		}
+		ExtractToken &token = batch.tokens[j];
+		token.err = _extract_file(token, batch, prefetched, buffer);
+		if (token.err != OK) {
+			broken_cnt++;
+		} else {
+			batch.bytes += token.file->get_size();
+		}
+		last_completed++;
+	}
+	batch.usec = OS::get_singleton()->get_ticks_usec() - start;
+}
+
+// Sorts the tokens by their offset in the pack and splits them into runs of neighbouring entries,
+// so each worker reads one contiguous region of the pack instead of seeking all over it.
+Vector<PckDumper::ExtractBatch> PckDumper::_make_extract_batches(Vector<ExtractToken> &tokens) {
+	Vector<ExtractBatch> batches;
+	if (tokens.is_empty()) {
+		return batches;
+	}
+	tokens.sort_custom<ExtractTokenOffsetComparator>();
+	uint64_t total_size = 0;
+	for (const ExtractToken &token : tokens) {
+		total_size += token.file->get_size();
+	}
+	uint64_t batch_size = opt_multi_thread ? total_size / (MAX(WorkerThreadPool::get_singleton()->get_thread_count(), 1) * 4) : MAX_BATCH_SIZE;
+	batch_size = CLAMP(batch_size, MIN_BATCH_SIZE, MAX_BATCH_SIZE);
+
+	ExtractToken *ptr = tokens.ptrw();
+	ExtractBatch batch;
+	for (int i = 0; i < tokens.size(); i++) {
+		const Ref<PackedFileInfo> &file = ptr[i].file;
+		bool same_pack = batch.count > 0 && batch.tokens->file->get_pack() == file->get_pack();
+		if (batch.count > 0 && (!same_pack || batch.range_size >= batch_size)) {
+			batches.push_back(batch);
+			batch = ExtractBatch();
+		}
+		if (batch.count == 0) {
+			batch.tokens = &ptr[i];
+			batch.range_start = file->get_offset();
+		}
+		batch.count++;
+		batch.range_size = MAX(batch.range_size, file->get_offset() + file->get_size() - batch.range_start);
+	}
+	batches.push_back(batch);
+	return batches;
+}
+
+void PckDumper::_print_batch_stats(const Vector<ExtractBatch> &batches, uint64_t total_usec, const String &p_action) {
+	struct WorkerStats {
+		uint32_t files = 0;
+		uint64_t bytes = 0;
+		uint64_t usec = 0;
+	};
+	auto mib_per_sec = [](uint64_t bytes, uint64_t usec) {
+		return String::num((double)bytes / (1024.0 * 1024.0) / MAX((double)usec / 1000000.0, 0.000001), 2);
+	};
+	HashMap<int, WorkerStats> stats;
+	uint64_t total_bytes = 0;
+	for (const ExtractBatch &batch : batches) {
+		WorkerStats &ws = stats[batch.worker];
+		ws.files += batch.count;
+		ws.bytes += batch.bytes;
+		ws.usec += batch.usec;
+		total_bytes += batch.bytes;
+	}
+	for (const KeyValue<int, WorkerStats> &E : stats) {
+		String name = E.key < 0 ? String("main thread") : "worker " + itos(E.key);
+		print_verbose(p_action + " by " + name + ": " + itos(E.value.files) + " files, " + String::humanize_size(E.value.bytes) + " at " + mib_per_sec(E.value.bytes, E.value.usec) + " MiB/s");
+	}
+	print_line(p_action + " " + String::humanize_size(total_bytes) + " in " + String::num((double)total_usec / 1000000.0, 2) + "s (" + mib_per_sec(total_bytes, total_usec) + " MiB/s)");
 }
 
 Error PckDumper::_pck_dump_to_dir(
@@ -209,104 +494,84 @@ Error PckDumper::_pck_dump_to_dir(
 	ERR_FAIL_COND_V_MSG(!GDRESettings::get_singleton()->is_pack_loaded(), ERR_DOES_NOT_EXIST,
 			"Pack not loaded!");
 	reset();
-	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
 	auto files = GDRESettings::get_singleton()->get_file_info_list();
-	Vector<uint8_t> key = GDRESettings::get_singleton()->get_encryption_key();
 	uint64_t last_progress_upd = OS::get_singleton()->get_ticks_usec();
 
 	if (DirAccess::create(DirAccess::ACCESS_FILESYSTEM).is_null()) {
 		return ERR_FILE_CANT_WRITE;
 	}
 	int files_extracted = 0;
-	Error err;
-	if (opt_multi_thread) {
-		Vector<ExtractToken> tokens;
-		Vector<String> paths_to_extract;
-		int actual = 0;
-		HashSet<String> files_to_extract_set;
-		for (const String &f : files_to_extract) {
-			files_to_extract_set.insert(f);
+	Error err = OK;
+	Vector<ExtractToken> tokens;
+	HashSet<String> files_to_extract_set;
+	for (const String &f : files_to_extract) {
+		files_to_extract_set.insert(f);
+	}
+	for (int i = 0; i < files.size(); i++) {
+		if (!files_to_extract_set.is_empty() && !files_to_extract_set.has(files.get(i)->get_path())) {
+			continue;
 		}
-		for (int i = 0; i < files.size(); i++) {
-			if (!files_to_extract_set.is_empty() && !files_to_extract_set.has(files.get(i)->get_path())) {
-				continue;
-			}
-			actual++;
-			if (pr) {
-				paths_to_extract.push_back(files.get(i)->get_path());
-			}
-			tokens.push_back({ files.get(i), dir, OK });
+		tokens.push_back({ files.get(i), dir, OK });
+	}
+	Vector<ExtractBatch> batches = _make_extract_batches(tokens);
+	// Progress is reported in extraction order
+	Vector<String> paths_to_extract;
+	if (pr) {
+		paths_to_extract.resize(tokens.size());
+		for (int i = 0; i < tokens.size(); i++) {
+			paths_to_extract.write[i] = tokens[i].file->get_path();
 		}
-		tokens.resize(actual);
-		paths_to_extract.resize(actual);
+	}
+	uint64_t start_time = OS::get_singleton()->get_ticks_usec();
+	if (opt_multi_thread) {
 		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
 				this,
-				&PckDumper::_do_extract,
-				tokens.ptrw(),
-				tokens.size(), -1, true, SNAME("PckDumper::_pck_dump_to_dir"));
+				&PckDumper::_do_extract_batch,
+				batches.ptrw(),
+				batches.size(), -1, true, SNAME("PckDumper::_pck_dump_to_dir"));
 		err = wait_for_task(group_task, paths_to_extract, pr);
-		files_extracted = last_completed + 1;
-		if (broken_cnt > 0) {
-			err = ERR_BUG;
-			for (int i = 0; i < tokens.size(); i++) {
-				if (tokens[i].err != OK) {
-					String err_type;
-					if (tokens[i].err == ERR_FILE_CANT_OPEN) {
-						err_type = "FileAccess error";
-					} else if (tokens[i].err == ERR_CANT_CREATE) {
-						err_type = "FileCreate error";
-					} else if (tokens[i].err == ERR_FILE_CANT_WRITE) {
-						err_type = "FileWrite error";
-					} else {
-						err_type = "Unknown error";
-					}
-					error_string += tokens[i].file->get_path() + "(" + itos(tokens[i].err) + ")\n";
-				}
-			}
-		}
 	} else {
-		for (int i = 0; i < files.size(); i++) {
-			if (files_to_extract.size() && !files_to_extract.has(files.get(i)->get_path())) {
-				continue;
-			}
-
+		for (int i = 0; i < batches.size(); i++) {
 			if (pr) {
 				if (OS::get_singleton()->get_ticks_usec() - last_progress_upd > 20000) {
 					last_progress_upd = OS::get_singleton()->get_ticks_usec();
-					bool cancel = pr->step(files.get(i)->get_path(), i, true);
+					int idx = CLAMP((int)last_completed, 0, tokens.size() - 1);
+					bool cancel = pr->step(paths_to_extract[idx], idx, true);
 					if (cancel) {
-						return ERR_PRINTER_ON_FIRE;
+						cancelled = true;
+						err = ERR_PRINTER_ON_FIRE;
+						break;
 					}
 				}
 			}
-			Ref<FileAccess> pck_f = FileAccess::open(files.get(i)->get_path(), FileAccess::READ, &err);
-			if (pck_f.is_null()) {
-				error_string += files.get(i)->get_path() + " (FileAccess error)\n";
-				continue;
-			}
-			String target_name = dir.path_join(files.get(i)->get_path().replace("res://", ""));
-			gdre::ensure_dir(target_name.get_base_dir());
-			Ref<FileAccess> fa = FileAccess::open(target_name, FileAccess::WRITE);
-			if (fa.is_null()) {
-				error_string += files.get(i)->get_path() + " (FileWrite error)\n";
-				continue;
-			}
-
-			int64_t rq_size = files.get(i)->get_size();
-			uint8_t buf[16384];
-			while (rq_size > 0) {
-				int got = pck_f->get_buffer(buf, MIN(16384, rq_size));
-				fa->store_buffer(buf, got);
-				rq_size -= 16384;
-			}
-			fa->flush();
-			files_extracted++;
-			if (files.get(i)->is_malformed() && files.get(i)->get_raw_path() != files.get(i)->get_path()) {
-				print_line("Warning: " + files.get(i)->get_raw_path() + " is a malformed path!\nSaving to " + files.get(i)->get_path() + " instead.");
+			_do_extract_batch(i, batches.ptrw());
+		}
+	}
+	uint64_t total_usec = OS::get_singleton()->get_ticks_usec() - start_time;
+	if (err == ERR_PRINTER_ON_FIRE) {
+		return err;
+	}
+	files_extracted = last_completed + 1 - broken_cnt;
+	if (broken_cnt > 0) {
+		for (int i = 0; i < tokens.size(); i++) {
+			if (tokens[i].err != OK) {
+				String err_type;
+				if (tokens[i].err == ERR_FILE_CANT_OPEN) {
+					err_type = "FileAccess error";
+				} else if (tokens[i].err == ERR_CANT_CREATE) {
+					err_type = "FileCreate error";
+				} else if (tokens[i].err == ERR_FILE_CANT_WRITE) {
+					err_type = "FileWrite error";
+				} else if (tokens[i].err == ERR_FILE_CORRUPT) {
+					err_type = "MD5 mismatch (wrong key?)";
+				} else {
+					err_type = "Unknown error";
+				}
+				error_string += tokens[i].file->get_path() + " (" + err_type + ")\n";
 			}
-			print_verbose("Extracted " + target_name);
 		}
 	}
+	_print_batch_stats(batches, total_usec, "Extracted");
 
 	if (error_string.length() > 0) {
 		print_error("At least one error was detected while extracting pack!\n" + error_string);
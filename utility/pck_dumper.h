@@ -19,15 +19,28 @@ class PckDumper : public RefCounted {
 	std::atomic<int> skipped_cnt = 0;
 	std::atomic<int> broken_cnt = 0;
 
-	bool _pck_file_check_md5(Ref<PackedFileInfo> &file);
-	void _do_md5_check(uint32_t i, Ref<PackedFileInfo> *tokens);
 	void reset();
 	struct ExtractToken {
 		Ref<PackedFileInfo> file;
 		String output_dir;
 		Error err = OK;
 	};
-	void _do_extract(uint32_t i, ExtractToken *tokens);
+	// A run of tokens that are adjacent in the same pack, extracted (or verified) in offset order by a single worker.
+	struct ExtractBatch {
+		ExtractToken *tokens = nullptr;
+		uint32_t count = 0;
+		uint64_t range_start = 0;
+		uint64_t range_size = 0;
+		// filled in by the worker
+		int worker = -1;
+		uint64_t bytes = 0;
+		uint64_t usec = 0;
+	};
+	Error _extract_file(ExtractToken &token, ExtractBatch &batch, bool &prefetched, Vector<uint8_t> &buffer);
+	void _do_extract_batch(uint32_t i, ExtractBatch *batches);
+	Vector<ExtractBatch> _make_extract_batches(Vector<ExtractToken> &tokens);
+	void _do_md5_check_batch(uint32_t i, ExtractBatch *batches);
+	void _print_batch_stats(const Vector<ExtractBatch> &batches, uint64_t total_usec, const String &p_action);
 	Error wait_for_task(WorkerThreadPool::GroupID group_task, const Vector<String> &paths_to_check, EditorProgressGDDC *pr);
 
 protected: